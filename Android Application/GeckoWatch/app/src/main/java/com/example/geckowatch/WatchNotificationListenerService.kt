@@ -7,10 +7,28 @@ import android.service.notification.StatusBarNotification
 import android.util.Log
 import com.example.geckowatch.data.ConnectionState
 import com.example.geckowatch.data.ble.SmartWatchBLEReceiveManager
+import java.io.ByteArrayOutputStream
 import java.util.TimeZone
 
 class WatchNotificationListenerService : NotificationListenerService() {
 
+    companion object {
+        // Must match SmartWatchService.h on the watch
+        private const val NOTIFICATION_VERSION = 2
+        private const val NOTIFICATION_MAX_SIZE = 480
+        private const val FIELD_HEADER_SIZE = 3
+        private const val FIELD_APP = 0x01
+        private const val FIELD_TITLE = 0x02
+        private const val FIELD_BODY = 0x03
+        private const val FIELD_TIMESTAMP = 0x04
+        private const val FIELD_ID = 0x05
+
+        // Room left for the terminator in the watch's Notification struct
+        private const val MAX_APP_NAME_BYTES = 63
+        private const val MAX_TITLE_BYTES = 63
+        private const val MAX_BODY_BYTES = 383
+    }
+
     private lateinit var smartWatchReceiveManager: SmartWatchBLEReceiveManager
 
     private val blockedPackages = setOf(
@@ -30,49 +48,64 @@ class WatchNotificationListenerService : NotificationListenerService() {
             )
 
             if (smartWatchReceiveManager.getConnectionState() == ConnectionState.Connected) {
-                // The watch expects the notification in the format,
-                //      appName:title:bodyText:timestamp
-                // Because it is using the ':' as a delimiter we have to scan through and replace them
-                //      probably replace them with a ; for now, we could have a customer code to look
-                //      for on the watch, but the difference between a ':' and a ';' on the small screen
-                //      is pretty small
-                val notificationStringBuilder = StringBuilder()
-
-                // App name
-                notificationStringBuilder.append(
-                    packageManager.getApplicationLabel(
-                        packageManager.getApplicationInfo(
-                            sbn.packageName,
-                            0
-                        )
-                    )
-                        .toString().replace(":", ";")
-                )
-                notificationStringBuilder.append(":")
-
-                // Notification Title
-                notificationStringBuilder.append(
-                    sbn.notification.extras.getString("android.title")?.replace(":", ";") ?: "[No Title]"
-                )
-                notificationStringBuilder.append(":")
-
-                // Notification Text
-                notificationStringBuilder.append(
-                    sbn.notification.extras.getString("android.text")?.replace(":", ";") ?: "[No Text]"
-                )
-                notificationStringBuilder.append(":")
+                // Sent as the watch's binary notification format, a version byte and then
+                //      type, length, value fields (SmartWatchService.h on the watch), so the text goes
+                //      over exactly as it is and there is nothing to escape
+                val appName = packageManager.getApplicationLabel(
+                    packageManager.getApplicationInfo(sbn.packageName, 0)
+                ).toString()
+                val title = sbn.notification.extras.getString("android.title") ?: "[No Title]"
+                val text = sbn.notification.extras.getString("android.text") ?: "[No Text]"
 
                 // Notification Timestamp, accounting for time zone and daylight savings
                 val timestamp = (sbn.postTime + TimeZone.getDefault().getOffset(sbn.postTime)) / 1000
                 Log.i("NotificationSending", "Timestamp $timestamp")
-                notificationStringBuilder.append(timestamp.toString().replace(":", ";"))
 
-                Log.i("WatchNotificationListener", "Sending Notification: $notificationStringBuilder")
-                smartWatchReceiveManager.writeNotification(notificationStringBuilder.toString().toByteArray(Charsets.UTF_8))
+                // The key is unique across apps, unlike sbn.id, and stays the same when the app updates it
+                val payload = ByteArrayOutputStream()
+                payload.write(NOTIFICATION_VERSION)
+                writeTextField(payload, FIELD_APP, appName, MAX_APP_NAME_BYTES)
+                writeTextField(payload, FIELD_TITLE, title, MAX_TITLE_BYTES)
+                writeNumberField(payload, FIELD_TIMESTAMP, timestamp, 8)
+                writeNumberField(payload, FIELD_ID, sbn.key.hashCode().toLong(), 4)
+                // Body last, it gets whatever room is left in the payload
+                writeTextField(payload, FIELD_BODY, text,
+                    minOf(MAX_BODY_BYTES, NOTIFICATION_MAX_SIZE - payload.size() - FIELD_HEADER_SIZE))
+
+                Log.i("WatchNotificationListener", "Sending Notification: $appName, $title, $text, $timestamp")
+                smartWatchReceiveManager.writeNotification(payload.toByteArray())
             }
         }
     }
 
+    // UTF-8 cut to what the watch keeps, backing off so a character is never split
+    private fun writeTextField(payload: ByteArrayOutputStream, type: Int, text: String, maxBytes: Int) {
+        val bytes = text.toByteArray(Charsets.UTF_8)
+        var length = minOf(bytes.size, maxBytes)
+        if (length < bytes.size) {
+            while (length > 0 && (bytes[length].toInt() and 0xC0) == 0x80) length--
+        }
+        writeFieldHeader(payload, type, length)
+        payload.write(bytes, 0, length)
+    }
+
+    // Big endian, the same as the time characteristic, without the leading zero bytes
+    private fun writeNumberField(payload: ByteArrayOutputStream, type: Int, value: Long, maxSize: Int) {
+        var size = maxSize
+        while (size > 1 && (value shr (8 * (size - 1))) and 0xFFL == 0L) size--
+        writeFieldHeader(payload, type, size)
+        for (i in size - 1 downTo 0) {
+            payload.write((value shr (8 * i)).toInt() and 0xFF)
+        }
+    }
+
+    // Type and then the value's length, big endian
+    private fun writeFieldHeader(payload: ByteArrayOutputStream, type: Int, length: Int) {
+        payload.write(type)
+        payload.write((length shr 8) and 0xFF)
+        payload.write(length and 0xFF)
+    }
+
     override fun onNotificationRemoved(sbn: StatusBarNotification?) {
         Log.i("WatchNotificationListener", "Notification removed: ${sbn.toString()}")
     }
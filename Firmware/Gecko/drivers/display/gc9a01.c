@@ -14,10 +14,15 @@
 #include <zephyr/logging/log.h>
 #include <inttypes.h>
 
-LOG_MODULE_REGISTER(gc9a01, CONFIG_DISPLAY_LOG_LEVEL_ERR);
+#include "gc9a01.h"
+#include "gc9a01_trace.h"
 
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(gc9a01, CONFIG_DISPLAY_LOG_LEVEL_ERR);
 
-// #define GC9A01_SPI_PROFILING
 
 /**
  * gc9a01 display controller driver.
@@ -44,6 +49,8 @@ LOG_MODULE_REGISTER(gc9a01, CONFIG_DISPLAY_LOG_LEVEL_ERR);
 #define GC9A01A_TEON        0x35     ///< Tearing effect line on
 #define GC9A01A_MADCTL      0x36   ///< Memory Access Control
 #define GC9A01A_VSCRSADD    0x37 ///< Vertical Scrolling Start Address
+#define GC9A01A_IDMOFF      0x38   ///< Idle Mode OFF
+#define GC9A01A_IDMON       0x39    ///< Idle Mode ON
 #define GC9A01A_PIXFMT      0x3A   ///< COLMOD: Pixel Format Set
 
 #define GC9A01A1_DFUNCTR 0xB6 ///< Display Function Control
@@ -91,6 +98,12 @@ LOG_MODULE_REGISTER(gc9a01, CONFIG_DISPLAY_LOG_LEVEL_ERR);
 #define SLPIN               0x10
 #define SLPOUT              0x11
 
+#ifdef CONFIG_GC9A01_COLOR_12BIT
+#define GC9A01_COLMOD       COLOR_MODE_12_BIT
+#else
+#define GC9A01_COLMOD       COLOR_MODE_16_BIT
+#endif
+
 #define RGB565(r, g, b)         (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3))
 
 typedef struct
@@ -121,7 +134,7 @@ static GC9A01A_init_cmd_t GC9A01A_init_cmds[] = {
     {0x8F, {0xFF}, 1, 0},
     {0xB6, {0x00, 0x00}, 2, 0},
     {0x36, {0x48}, 1, 0}, // This one might need to be changed if it's being weird
-    {0x3A, {0x05}, 1, 0},
+    {0x3A, {GC9A01_COLMOD}, 1, 0},
     {0x90, {0x08, 0x08, 0x08, 0x08}, 4, 0},
     {0xBD, {0x06}, 1, 0},
     {0xBC, {0x00}, 1, 0},
@@ -148,18 +161,109 @@ static GC9A01A_init_cmd_t GC9A01A_init_cmds[] = {
     {0x67, {0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98}, 10, 0},
     {0x74, {0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00}, 7, 0},
     {0x98, {0x3E, 0x07}, 2, 0},
-    {0x35, {0}, 0, 0},
+    {0x35, {0x00}, 1, 0}, // TE output on V-blank only
     {0x21, {0}, 0, 0},
+    // Datasheet waits: 120 ms after sleep out before the panel is up, 20 ms after display on.
+    //  The bring-up gives the bus back while it waits them out, see gc9a01_init_work_handler().
     {0x11, {0}, 0, 120},
     {0x29, {0}, 0, 20},
-    {0x00, {0}, 0xFF, 20} // End of sequence command
+    {0x00, {0}, 0xFF, 0} // End of sequence command
 };
 
+#define GC9A01_HAS_TE   DT_INST_NODE_HAS_PROP(0, te_gpios)
+
+// Longest we hold a flush waiting for a TE edge, a bit over two frames at 60 Hz
+#define GC9A01_TE_TIMEOUT_MS    40
+
 struct gc9a01_config {
     struct spi_dt_spec  bus;
     struct gpio_dt_spec dc_gpio;
     struct pwm_dt_spec  bl_pwm;
     struct gpio_dt_spec reset_gpio;
+#if GC9A01_HAS_TE
+    struct gpio_dt_spec te_gpio;
+#endif
+};
+
+#ifdef CONFIG_GC9A01_ROUND_MASK
+#define GC9A01_TX_BUFS_MAX  CONFIG_GC9A01_ROUND_MASK_BAND_ROWS
+#else
+#define GC9A01_TX_BUFS_MAX  1
+#endif
+
+// Visible columns of one panel row, start > end means the row has nothing to show
+struct gc9a01_span {
+    uint8_t start, end;
+};
+
+// Sleep in/out timing from the datasheet: 5 ms before any other command may follow and
+//  120 ms before the opposite sleep command may follow
+#define GC9A01_SLEEP_CMD_SETTLE_MS      5
+#define GC9A01_SLEEP_TOGGLE_SETTLE_MS   120
+
+// The bring-up and the sleep state machine run from the driver's own work queue, they wait out
+//  controller delays and must not hold up the system work queue while they do
+#define GC9A01_WORKQ_STACK_SIZE 1024
+
+K_THREAD_STACK_DEFINE(gc9a01_workq_stack, GC9A01_WORKQ_STACK_SIZE);
+static struct k_work_q gc9a01_workq;
+
+// Packed RGB444 staging buffer size, must hold a whole number of pixel pairs (3 bytes each)
+#define GC9A01_PACK_CHUNK   (3 * 512)
+
+struct gc9a01_data {
+    const struct device *dev;
+    // Keeps the flush thread and the sleep work item from interleaving on the bus
+    struct k_mutex lock;
+    // Controller bring-up runs from a work item, callers wait on this until it has gone through
+    struct k_work_delayable init_work;
+    int init_step;              // Next init table entry to send
+    struct k_sem init_done;
+    bool initialized;
+    // Config the command path sends with, the bring-up swaps in one that holds CS between commands
+    const struct spi_config *spi_cfg;
+    struct spi_config batch_cfg;
+    // Sleep state machine, the work item sends a sleep command that wasn't allowed yet
+    struct k_work_delayable sleep_work;
+    bool asleep;                // What the controller was last told
+    bool want_asleep;           // What we were last asked for
+    bool always_on;             // Partial + idle mode is on
+    // Hardware vertical scroll, scroll_rows == 0 when off. Screen row scroll_top shows GRAM row
+    //  scroll_top + scroll_offset and the area wraps around below that.
+    uint16_t scroll_top;
+    uint16_t scroll_rows;
+    uint16_t scroll_offset;
+    int64_t cmd_ready_at;       // Uptime (ms) the controller takes commands again
+    int64_t toggle_ready_at;    // Uptime (ms) the opposite sleep command is allowed
+#ifdef CONFIG_GC9A01_COLOR_12BIT
+    // Ping-pong so one chunk can be packed while the other is still going out
+    uint8_t pack_bufs[2][GC9A01_PACK_CHUNK];
+    uint8_t pack_idx;
+#endif
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+    // Held while a DMA transfer is on the wire, given back from the SPI completion callback
+    struct k_sem tx_idle;
+    struct spi_buf tx_bufs[GC9A01_TX_BUFS_MAX];
+    struct spi_buf_set tx_buf_set;
+#endif
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    struct gc9a01_span round_spans[DISPLAY_HEIGHT];
+#endif
+#if GC9A01_HAS_TE
+    struct gpio_callback te_cb;
+    struct k_sem te_sem;
+    gc9a01_vsync_cb_t vsync_cb;
+    void *vsync_user_data;
+#endif
+#ifdef CONFIG_GC9A01_STATS
+    struct gc9a01_stats stats;
+    // Guards the flush timing against the SPI completion callback
+    struct k_spinlock stats_lock;
+    uint32_t flush_start;
+    bool flush_end_pending;
+    gc9a01_flush_cb_t flush_cb;
+    void *flush_user_data;
+#endif
 };
 
 struct gc9a01_point {
@@ -170,16 +274,146 @@ struct gc9a01_frame {
     struct gc9a01_point start, end;
 };
 
+// Window the controller currently has programmed. Rows are always set open ended (down to the
+//  last row) so a stripe directly below the last one can carry on with MEM_WR_CONT.
 static struct gc9a01_frame frame = {{0, 0}, {DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1}};
+static bool frame_valid;
+// Row the controller's address pointer is sitting at after the last memory write
+static uint16_t frame_next_row;
+
+#ifdef CONFIG_GC9A01_STATS
+static inline uint8_t gc9a01_stats_area_bucket(uint32_t pixels)
+{
+    uint8_t bucket = 0;
+
+    // Buckets go up by 4x starting at 256 pixels, anything bigger lands in the last one
+    while (bucket < GC9A01_STATS_AREA_BUCKETS - 1 && pixels >= (256U << (2 * bucket))) {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+static void gc9a01_stats_flush_begin(struct gc9a01_data *data, const struct display_buffer_descriptor *desc)
+{
+    uint32_t pixels = desc->width * desc->height;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+    gc9a01_flush_cb_t flush_cb = data->flush_cb;
+    void *flush_user_data = data->flush_user_data;
+
+    data->stats.flushes++;
+    data->stats.area_hist[gc9a01_stats_area_bucket(pixels)]++;
+    data->stats.rect_bytes += pixels * 2;
+    data->flush_start = k_cycle_get_32();
+    k_spin_unlock(&data->stats_lock, key);
+
+    if (flush_cb != NULL) {
+        flush_cb(data->dev, GC9A01_FLUSH_BEGIN, flush_user_data);
+    }
+}
+
+// The counter is 64-bit, without the lock a reader could catch it half updated
+static void gc9a01_stats_add_bytes(struct gc9a01_data *data, size_t len)
+{
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->stats.bytes += len;
+    k_spin_unlock(&data->stats_lock, key);
+}
+
+// Last byte of the flush is off the wire, called with stats_lock held. Returns the flush callback
+//  (and its user data) for the caller to run once the lock is dropped.
+static gc9a01_flush_cb_t gc9a01_stats_flush_close(struct gc9a01_data *data, void **flush_user_data)
+{
+    uint32_t cycles = k_cycle_get_32() - data->flush_start;
+
+    data->stats.cycles += cycles;
+    data->stats.max_cycles = MAX(data->stats.max_cycles, cycles);
+
+    *flush_user_data = data->flush_user_data;
+    return data->flush_cb;
+}
+#endif
+
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+static void gc9a01_tx_done(const struct device *spi_dev, int result, void *user_data)
+{
+    struct gc9a01_data *data = user_data;
+
+    if (result != 0) {
+        LOG_ERR("Async transfer failed (%d)", result);
+    }
+
+#ifdef CONFIG_GC9A01_STATS
+    gc9a01_flush_cb_t flush_cb = NULL;
+    void *flush_user_data = NULL;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+    if (data->flush_end_pending) {
+        flush_cb = gc9a01_stats_flush_close(data, &flush_user_data);
+        data->flush_end_pending = false;
+    }
+    k_spin_unlock(&data->stats_lock, key);
+
+    if (flush_cb != NULL) {
+        flush_cb(data->dev, GC9A01_FLUSH_END, flush_user_data);
+    }
+#endif
+
+    // Pixel buffer is free again, this is what lets the next flush start
+    k_sem_give(&data->tx_idle);
+}
+#endif
+
+// Block until any in flight pixel transfer is off the wire, the DC line can't be touched before then
+static inline void gc9a01_wait_idle(const struct device *dev)
+{
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+    struct gc9a01_data *data = dev->data;
+
+    k_sem_take(&data->tx_idle, K_FOREVER);
+    k_sem_give(&data->tx_idle);
+#endif
+}
+
+// Hold off until the controller takes commands again, this is at most the short settle after a
+//  sleep command, never the full sleep in/out time
+static inline void gc9a01_wait_ready(const struct device *dev)
+{
+    struct gc9a01_data *data = dev->data;
+    int64_t wait = data->cmd_ready_at - k_uptime_get();
+
+    if (wait > 0) {
+        k_msleep((int32_t) wait);
+    }
+}
+
+// Take the bus for a caller from outside the driver, anything that shows up before the controller
+//  bring-up has finished waits for it here
+static inline void gc9a01_lock(const struct device *dev)
+{
+    struct gc9a01_data *data = dev->data;
+
+    if (!data->initialized) {
+        k_sem_take(&data->init_done, K_FOREVER);
+        k_sem_give(&data->init_done);
+    }
+    k_mutex_lock(&data->lock, K_FOREVER);
+}
 
 static inline int gc9a01_write_cmd(const struct device *dev, uint8_t cmd,
                                    const uint8_t *data, size_t len)
 {
     const struct gc9a01_config *config = dev->config;
+    const struct spi_config *spi_cfg = ((struct gc9a01_data *) dev->data)->spi_cfg;
     struct spi_buf buf = {.buf = &cmd, .len = sizeof(cmd)};
     struct spi_buf_set buf_set = {.buffers = &buf, .count = 1};
+
+    gc9a01_trace_cmd(cmd);
+    gc9a01_wait_idle(dev);
+    gc9a01_wait_ready(dev);
+
     gpio_pin_set_dt(&config->dc_gpio, 0);
-    if (spi_write_dt(&config->bus, &buf_set) != 0) {
+    if (spi_write(config->bus.bus, spi_cfg, &buf_set) != 0) {
         LOG_ERR("Failed sending data");
         return -EIO;
     }
@@ -187,8 +421,9 @@ static inline int gc9a01_write_cmd(const struct device *dev, uint8_t cmd,
     if (data != NULL && len != 0) {
         buf.buf = (void *)data;
         buf.len = len;
+        gc9a01_trace_data(data, len, false);
         gpio_pin_set_dt(&config->dc_gpio, 1);
-        if (spi_write_dt(&config->bus, &buf_set) != 0) {
+        if (spi_write(config->bus.bus, spi_cfg, &buf_set) != 0) {
             LOG_ERR("Failed sending data");
             return -EIO;
         }
@@ -197,24 +432,347 @@ static inline int gc9a01_write_cmd(const struct device *dev, uint8_t cmd,
     return 0;
 }
 
-static void gc9a01_set_frame(const struct device *dev, struct gc9a01_frame frame)
+// Send a memory write (RAMWR or MEM_WR_CONT) followed by the data in bufs, all under a single chip select.
+// In async mode this hands the data to the SPIM DMA without waiting for it to finish, the
+// caller owns the pixel memory until the next write or command (which will wait on it).
+static int gc9a01_send_pixels(const struct device *dev, uint8_t cmd,
+                              const struct spi_buf *bufs, size_t count)
+{
+    const struct gc9a01_config *config = dev->config;
+    size_t len = 0;
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+    struct gc9a01_data *data = dev->data;
+#else
+    struct spi_buf_set buf_set = {.buffers = bufs, .count = count};
+#endif
+
+    gc9a01_write_cmd(dev, cmd, NULL, 0);
+
+    for (size_t i = 0; i < count; i++) {
+        len += bufs[i].len;
+    }
+#ifdef CONFIG_GC9A01_STATS
+    gc9a01_stats_add_bytes(dev->data, len);
+#endif
+    gc9a01_trace_data(NULL, len, IS_ENABLED(CONFIG_GC9A01_FLUSH_ASYNC));
+
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+    __ASSERT(count <= ARRAY_SIZE(data->tx_bufs), "Too many pixel buffers");
+
+    k_sem_take(&data->tx_idle, K_FOREVER);
+    memcpy(data->tx_bufs, bufs, count * sizeof(struct spi_buf));
+    data->tx_buf_set.count = count;
+    gpio_pin_set_dt(&config->dc_gpio, 1);
+    if (spi_transceive_cb(config->bus.bus, &config->bus.config, &data->tx_buf_set, NULL,
+                          gc9a01_tx_done, data) != 0) {
+        LOG_ERR("Failed starting async transfer");
+        k_sem_give(&data->tx_idle);
+        return -EIO;
+    }
+#else
+    gpio_pin_set_dt(&config->dc_gpio, 1);
+    if (spi_write_dt(&config->bus, &buf_set) != 0) {
+        LOG_ERR("Failed sending data");
+        return -EIO;
+    }
+#endif
+
+    return 0;
+}
+
+#ifdef CONFIG_GC9A01_COLOR_12BIT
+// Pack pairs of big endian RGB565 pixels into 12-bit RGB444, 4 bytes in and 3 bytes out.
+// Both pixels are handled with one 32-bit load, the masks never pull bits across the halves.
+static void gc9a01_pack_rgb444(uint8_t *dst, const uint8_t *src, size_t pairs)
+{
+    while (pairs--) {
+        uint32_t w = sys_get_be32(src);
+
+        // Top 4 bits of each channel, RRRR GGGG BBBB per 16-bit half
+        w = ((w >> 4) & 0x0F000F00) | ((w >> 3) & 0x00F000F0) | ((w >> 1) & 0x000F000F);
+        // Close the 4-bit gap between the two pixels
+        w = ((w >> 4) & 0x00FFF000) | (w & 0x00000FFF);
+        sys_put_be24(w, dst);
+
+        src += 4;
+        dst += 3;
+    }
+}
+
+// Start sending the current chunk and move on to the other one
+static int gc9a01_send_chunk(const struct device *dev, uint8_t cmd, size_t len)
+{
+    struct gc9a01_data *data = dev->data;
+    struct spi_buf chunk = {.buf = data->pack_bufs[data->pack_idx], .len = len};
+
+    data->pack_idx ^= 1;
+    return gc9a01_send_pixels(dev, cmd, &chunk, 1);
+}
+
+// Stream the RGB565 pixels in bufs out as RGB444. The first chunk goes out with cmd and every
+//  chunk after it picks up where the last left off with MEM_WR_CONT.
+// Rows can be an odd number of pixels, the leftover pixel is carried into the next row.
+// The caller's buffer is no longer needed when this returns, only the packed copy is in flight.
+static int gc9a01_write_pixels(const struct device *dev, uint8_t cmd,
+                               const struct spi_buf *bufs, size_t count)
+{
+    struct gc9a01_data *data = dev->data;
+    uint8_t pair[4];
+    bool carry = false;
+    size_t fill = 0;
+    int error;
+
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *src = bufs[i].buf;
+        size_t pixels = bufs[i].len / 2;
+
+        while (pixels > 0) {
+            if (fill == GC9A01_PACK_CHUNK) {
+                error = gc9a01_send_chunk(dev, cmd, fill);
+                if (error) return error;
+                cmd = MEM_WR_CONT;
+                fill = 0;
+            }
+
+            if (carry) {
+                memcpy(&pair[2], src, 2);
+                gc9a01_pack_rgb444(&data->pack_bufs[data->pack_idx][fill], pair, 1);
+                fill += 3;
+                src += 2;
+                pixels--;
+                carry = false;
+                continue;
+            }
+
+            if (pixels == 1) {
+                memcpy(pair, src, 2);
+                carry = true;
+                break;
+            }
+
+            size_t pairs = MIN(pixels / 2, (GC9A01_PACK_CHUNK - fill) / 3);
+            gc9a01_pack_rgb444(&data->pack_bufs[data->pack_idx][fill], src, pairs);
+            fill += pairs * 3;
+            src += pairs * 4;
+            pixels -= pairs * 2;
+        }
+    }
+
+    if (carry) {
+        if (fill == GC9A01_PACK_CHUNK) {
+            error = gc9a01_send_chunk(dev, cmd, fill);
+            if (error) return error;
+            cmd = MEM_WR_CONT;
+            fill = 0;
+        }
+        // Only the first 12 bits make a pixel, the dangling nibble is dropped by the next command
+        memset(&pair[2], 0, 2);
+        gc9a01_pack_rgb444(&data->pack_bufs[data->pack_idx][fill], pair, 1);
+        fill += 2;
+    }
+
+    if (fill == 0) return 0;
+    return gc9a01_send_chunk(dev, cmd, fill);
+}
+#else
+static inline int gc9a01_write_pixels(const struct device *dev, uint8_t cmd,
+                                      const struct spi_buf *bufs, size_t count)
+{
+    return gc9a01_send_pixels(dev, cmd, bufs, count);
+}
+#endif
+
+// Forget the cached window, anything that can move the controller's address pointer or
+//  reprogram the window behind our back has to call this
+static inline void gc9a01_frame_invalidate(void)
+{
+    frame_valid = false;
+}
+
+// Point the controller at the area x_start..x_end, y_start..y_end, only sending the address
+//  commands that actually change something. Returns the memory write command to start with,
+//  MEM_WR_CONT when the area picks up exactly where the last write left off.
+static uint8_t gc9a01_set_frame(const struct device *dev, uint16_t x_start, uint16_t x_end,
+                                uint16_t y_start, uint16_t y_end)
 {
     uint8_t data[4];
+    bool cols_same = frame_valid && frame.start.X == x_start && frame.end.X == x_end;
+    bool rows_same = frame_valid && frame.start.Y == y_start;
+    bool follows = cols_same && y_start == frame_next_row;
+
+    frame_next_row = y_end + 1;
+
+    if (follows) return MEM_WR_CONT;
+
+    if (!cols_same) {
+        data[0] = (x_start >> 8) & 0xFF;
+        data[1] = x_start & 0xFF;
+        data[2] = (x_end >> 8) & 0xFF;
+        data[3] = x_end & 0xFF;
+        gc9a01_write_cmd(dev, COL_ADDR_SET, data, sizeof(data));
+        frame.start.X = x_start;
+        frame.end.X = x_end;
+    }
+
+    if (!rows_same) {
+        data[0] = (y_start >> 8) & 0xFF;
+        data[1] = y_start & 0xFF;
+        data[2] = ((DISPLAY_HEIGHT - 1) >> 8) & 0xFF;
+        data[3] = (DISPLAY_HEIGHT - 1) & 0xFF;
+        gc9a01_write_cmd(dev, ROW_ADDR_SET, data, sizeof(data));
+        frame.start.Y = y_start;
+        frame.end.Y = DISPLAY_HEIGHT - 1;
+    }
+
+    frame_valid = true;
+
+    return GC9A01A_RAMWR;
+}
+
+// Send whichever sleep command gets the controller to the state we were asked for. If it is
+//  still settling from the last one the work item comes back and does it once that is over,
+//  the caller never waits. Called with the lock held.
+static void gc9a01_sleep_apply(const struct device *dev)
+{
+    struct gc9a01_data *data = dev->data;
+    int64_t now = k_uptime_get();
+
+    if (data->asleep == data->want_asleep) return;
+
+    if (now < data->toggle_ready_at) {
+        k_work_reschedule_for_queue(&gc9a01_workq, &data->sleep_work, K_MSEC(data->toggle_ready_at - now));
+        return;
+    }
+
+    gc9a01_write_cmd(dev, data->want_asleep ? GC9A01A_SLPIN : GC9A01A_SLPOUT, NULL, 0);
+    gc9a01_frame_invalidate();
+
+    now = k_uptime_get();
+    data->asleep = data->want_asleep;
+    data->cmd_ready_at = now + GC9A01_SLEEP_CMD_SETTLE_MS;
+    data->toggle_ready_at = now + GC9A01_SLEEP_TOGGLE_SETTLE_MS;
+}
+
+static void gc9a01_sleep_work_handler(struct k_work *work)
+{
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct gc9a01_data *data = CONTAINER_OF(dwork, struct gc9a01_data, sleep_work);
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    gc9a01_sleep_apply(data->dev);
+    k_mutex_unlock(&data->lock);
+}
+
+static int gc9a01_set_sleep(const struct device *dev, bool asleep)
+{
+    struct gc9a01_data *data = dev->data;
+
+    gc9a01_lock(dev);
+    data->want_asleep = asleep;
+    gc9a01_sleep_apply(dev);
+    k_mutex_unlock(&data->lock);
+
+    return 0;
+}
+
+int gc9a01_always_on_enter(const struct device *dev, uint16_t start_row, uint16_t end_row)
+{
+    struct gc9a01_data *data = dev->data;
+    uint8_t rows[4];
+
+    if (start_row > end_row || end_row >= DISPLAY_HEIGHT) return -EINVAL;
+
+    sys_put_be16(start_row, &rows[0]);
+    sys_put_be16(end_row, &rows[2]);
+
+    gc9a01_lock(dev);
+
+    // Partial mode needs the panel running, undo any sleep that is pending
+    data->want_asleep = false;
+    gc9a01_sleep_apply(dev);
+
+    gc9a01_write_cmd(dev, GC9A01A_PTLAR, rows, sizeof(rows));
+    gc9a01_write_cmd(dev, GC9A01A_PTLON, NULL, 0);
+    gc9a01_write_cmd(dev, GC9A01A_IDMON, NULL, 0);
+    gc9a01_frame_invalidate();
+    data->always_on = true;
+
+    k_mutex_unlock(&data->lock);
+
+    return 0;
+}
+
+int gc9a01_always_on_exit(const struct device *dev)
+{
+    struct gc9a01_data *data = dev->data;
+
+    gc9a01_lock(dev);
+
+    if (data->always_on) {
+        data->scroll_rows = 0; // Normal mode also ends vertical scrolling
+        gc9a01_write_cmd(dev, GC9A01A_IDMOFF, NULL, 0);
+        gc9a01_write_cmd(dev, GC9A01A_NORON, NULL, 0);
+        gc9a01_frame_invalidate();
+        data->always_on = false;
+    }
+
+    k_mutex_unlock(&data->lock);
+
+    return 0;
+}
+
+int gc9a01_scroll_area_set(const struct device *dev, uint16_t top_fixed, uint16_t scroll_rows)
+{
+    struct gc9a01_data *data = dev->data;
+    uint8_t params[6];
+
+    if (top_fixed + scroll_rows > DISPLAY_HEIGHT) return -EINVAL;
+
+    gc9a01_lock(dev);
+
+    if (scroll_rows == 0) {
+        // Scrolling ends with the switch back to normal (or partial) mode
+        gc9a01_write_cmd(dev, data->always_on ? GC9A01A_PTLON : GC9A01A_NORON, NULL, 0);
+    } else {
+        sys_put_be16(top_fixed, &params[0]);
+        sys_put_be16(scroll_rows, &params[2]);
+        sys_put_be16(DISPLAY_HEIGHT - top_fixed - scroll_rows, &params[4]);
+        gc9a01_write_cmd(dev, GC9A01A_VSCRDEF, params, sizeof(params));
+        sys_put_be16(top_fixed, &params[0]);
+        gc9a01_write_cmd(dev, GC9A01A_VSCRSADD, params, 2);
+    }
+
+    data->scroll_top = top_fixed;
+    data->scroll_rows = scroll_rows;
+    data->scroll_offset = 0;
+    gc9a01_frame_invalidate();
+
+    k_mutex_unlock(&data->lock);
+
+    return 0;
+}
+
+int gc9a01_scroll_to(const struct device *dev, uint16_t offset)
+{
+    struct gc9a01_data *data = dev->data;
+    uint8_t params[2];
+
+    gc9a01_lock(dev);
+
+    if (data->scroll_rows == 0) {
+        k_mutex_unlock(&data->lock);
+        return -EINVAL;
+    }
+
+    data->scroll_offset = offset % data->scroll_rows;
+    sys_put_be16(data->scroll_top + data->scroll_offset, params);
+    gc9a01_write_cmd(dev, GC9A01A_VSCRSADD, params, sizeof(params));
 
-    data[0] = (frame.start.X >> 8) & 0xFF;
-    data[1] = frame.start.X & 0xFF;
-    data[2] = (frame.end.X >> 8) & 0xFF;
-    data[3] = frame.end.X & 0xFF;
-    gc9a01_write_cmd(dev, COL_ADDR_SET, data, sizeof(data));
+    k_mutex_unlock(&data->lock);
 
-    data[0] = (frame.start.Y >> 8) & 0xFF;
-    data[1] = frame.start.Y & 0xFF;
-    data[2] = (frame.end.Y >> 8) & 0xFF;
-    data[3] = frame.end.Y & 0xFF;
-    gc9a01_write_cmd(dev, ROW_ADDR_SET, data, sizeof(data));
+    return 0;
 }
 
-// EXIT SLEEP/WAKE UP
 static int gc9a01_blanking_off(const struct device *dev)
 {
     // return gc9a01_write_cmd(dev, GC9A01A_DISPON, NULL, 0);
@@ -222,13 +780,9 @@ static int gc9a01_blanking_off(const struct device *dev)
     // Intention for the interface is to just have a un-clear the display but 
     //      we will have this function wake the display up
     //
-    gc9a01_write_cmd(dev, GC9A01A_SLPOUT, NULL, 0);
-
-    // Must wait at least 5 ms before next command, 120 ms before sending sleep out
-    // Fix this in the future, we need a mutex and timer here, for now just wait it out
-    k_msleep(150);
-    
-    return 0;
+    // Writes that come in right after this only wait out the 5 ms command settle, the GRAM
+    //  keeps whatever they draw and it shows as soon as the panel is out of sleep
+    return gc9a01_set_sleep(dev, false);
 }
 
 // ENTER SLEEP
@@ -239,52 +793,287 @@ static int gc9a01_blanking_on(const struct device *dev)
     // Intention for the interface is to just have a clear display but 
     //      we will have this function put the display into sleep mode
     //
-    gc9a01_write_cmd(dev, GC9A01A_SLPIN, NULL, 0);
+    return gc9a01_set_sleep(dev, true);
+}
+
+#ifdef CONFIG_GC9A01_ROUND_MASK
+// Fill in the visible span of every row of the round panel, done once at init
+static void gc9a01_round_mask_init(struct gc9a01_data *data)
+{
+    const float radius = DISPLAY_WIDTH / 2.0f;
+
+    for (int row = 0; row < DISPLAY_HEIGHT; row++) {
+        // Sample through the middle of the row so the outline is symmetric top to bottom
+        float dy = (row + 0.5f) - (DISPLAY_HEIGHT / 2.0f);
+        float half = radius * radius - dy * dy;
+
+        if (half <= 0.0f) {
+            data->round_spans[row].start = 1;
+            data->round_spans[row].end = 0;
+            continue;
+        }
+
+        half = sqrtf(half);
+        data->round_spans[row].start = (uint8_t) MAX(0, (int) floorf(radius - half));
+        data->round_spans[row].end = (uint8_t) MIN(DISPLAY_WIDTH - 1, (int) ceilf(radius + half) - 1);
+    }
+}
+
+// Send only the part of the area that lands inside the circle.
+// Rows are grouped into bands so we don't pay for a new window on every row, each band gets
+//  the widest span of its rows and every row of the band goes out as one buffer of a single RAMWR.
+static int gc9a01_write_round(const struct device *dev, const uint16_t x, const uint16_t y,
+                              const struct display_buffer_descriptor *desc, const uint8_t *buf)
+{
+    struct gc9a01_data *data = dev->data;
+    struct spi_buf bufs[GC9A01_TX_BUFS_MAX];
+    uint16_t x_end_idx = x + desc->width - 1;
+    uint16_t y_end_idx = y + desc->height - 1;
+    uint16_t band_start = y;
+    uint16_t band_end;
+    int error = 0;
+
+    while (band_start <= y_end_idx) {
+        // Bands are aligned to the panel, not the area, so every flush clips the same way
+        band_end = MIN(((band_start / GC9A01_TX_BUFS_MAX) + 1) * GC9A01_TX_BUFS_MAX - 1, y_end_idx);
+
+        uint16_t span_start = DISPLAY_WIDTH;
+        uint16_t span_end = 0;
+        for (uint16_t row = band_start; row <= band_end; row++) {
+            if (data->round_spans[row].start > data->round_spans[row].end) continue;
+            span_start = MIN(span_start, data->round_spans[row].start);
+            span_end = MAX(span_end, data->round_spans[row].end);
+        }
+        span_start = MAX(span_start, x);
+        span_end = MIN(span_end, x_end_idx);
+
+        if (span_start <= span_end) {
+            size_t row_len = (span_end - span_start + 1) * 2;
+            size_t count = 0;
+
+            for (uint16_t row = band_start; row <= band_end; row++) {
+                bufs[count].buf = (void *)(buf + ((row - y) * desc->pitch + (span_start - x)) * 2);
+                bufs[count].len = row_len;
+                count++;
+            }
 
-    // Must wait at least 5 ms before next command, 120 ms before sending sleep out
-    // Fix this in the future, we need a mutex and timer here, for now just wait it out
-    k_msleep(150);
+            uint8_t cmd = gc9a01_set_frame(dev, span_start, span_end, band_start, band_end);
+
+            error = gc9a01_write_pixels(dev, cmd, bufs, count);
+            if (error) break;
+        }
+
+        band_start = band_end + 1;
+    }
+
+    return error;
+}
+#endif // CONFIG_GC9A01_ROUND_MASK
+
+#if GC9A01_HAS_TE
+static void gc9a01_te_isr(const struct device *port, struct gpio_callback *cb, uint32_t pins)
+{
+    struct gc9a01_data *data = CONTAINER_OF(cb, struct gc9a01_data, te_cb);
+    gc9a01_vsync_cb_t vsync_cb = data->vsync_cb;
+
+    k_sem_give(&data->te_sem);
+    if (vsync_cb != NULL) {
+        vsync_cb(data->dev, data->vsync_user_data);
+    }
+}
+
+// Hold a big flush until the panel starts its next refresh so the scan doesn't catch the write
+//  pointer mid frame. Only the first stripe of a sweep waits, the rest follow on right behind it.
+static void gc9a01_te_wait(const struct device *dev, const uint16_t y,
+                           const struct display_buffer_descriptor *desc)
+{
+    struct gc9a01_data *data = dev->data;
+
+    if (data->asleep) return; // No TE out of a sleeping panel
+    if (desc->width * desc->height < CONFIG_GC9A01_TE_MIN_PIXELS) return;
+    if (frame_valid && y == frame_next_row) return;
+
+    k_sem_reset(&data->te_sem);
+    k_sem_take(&data->te_sem, K_MSEC(GC9A01_TE_TIMEOUT_MS));
+}
+#endif
+
+int gc9a01_vsync_callback_set(const struct device *dev, gc9a01_vsync_cb_t cb, void *user_data)
+{
+#if GC9A01_HAS_TE
+    struct gc9a01_data *data = dev->data;
+
+    data->vsync_user_data = user_data;
+    data->vsync_cb = cb;
 
     return 0;
+#else
+    return -ENOTSUP;
+#endif
+}
+
+static int gc9a01_write_rect(const struct device *dev, const uint16_t x, const uint16_t y,
+                             const struct display_buffer_descriptor *desc, const void *buf)
+{
+    uint16_t x_end_idx = x + desc->width - 1;
+    uint16_t y_end_idx = y + desc->height - 1;
+
+    size_t len = (x_end_idx + 1 - x) * (y_end_idx + 1 - y) * 16 / 8;
+    struct spi_buf pixels = {.buf = (void *)buf, .len = len};
+    //printk("x_start: %d, y_start: %d, x_end: %d, y_end: %d, buf_size: %d, pitch: %d len: %d\n", x, y, x_end_idx, y_end_idx, desc->buf_size, desc->pitch, len);
+
+    uint8_t cmd = gc9a01_set_frame(dev, x, x_end_idx, y, y_end_idx);
+    return gc9a01_write_pixels(dev, cmd, &pixels, 1);
+}
+
+static inline int gc9a01_write_clipped(const struct device *dev, const uint16_t x, const uint16_t y,
+                                       const struct display_buffer_descriptor *desc, const void *buf)
+{
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    return gc9a01_write_round(dev, x, y, desc, buf);
+#else
+    return gc9a01_write_rect(dev, x, y, desc, buf);
+#endif
+}
+
+// With hardware scroll on, screen rows inside the scroll area live somewhere else in GRAM.
+// Split the area wherever the mapping jumps (the fixed areas and the wrap of the scroll area)
+//  and send every piece to where the panel is currently showing it.
+static int gc9a01_write_scrolled(const struct device *dev, const uint16_t x, const uint16_t y,
+                                 const struct display_buffer_descriptor *desc, const void *buf)
+{
+    struct gc9a01_data *data = dev->data;
+    uint16_t scroll_end = data->scroll_top + data->scroll_rows;
+    struct display_buffer_descriptor part = *desc;
+    uint16_t row = 0;
+    int error = 0;
+
+    while (row < desc->height && !error) {
+        uint16_t screen_row = y + row;
+        uint16_t gram_row = screen_row;
+        uint16_t rows = desc->height - row;
+        bool scrolled = screen_row >= data->scroll_top && screen_row < scroll_end;
+
+        if (scrolled) {
+            uint16_t pos = (screen_row - data->scroll_top + data->scroll_offset) % data->scroll_rows;
+            gram_row = data->scroll_top + pos;
+            rows = MIN(rows, MIN(scroll_end - screen_row, data->scroll_rows - pos));
+        } else if (screen_row < data->scroll_top) {
+            rows = MIN(rows, data->scroll_top - screen_row);
+        }
+
+        part.height = rows;
+        part.buf_size = rows * desc->pitch * 2;
+        const uint8_t *part_buf = (const uint8_t *)buf + row * desc->pitch * 2;
+
+        // Scrolled rows travel up and down the panel, the round mask would leave holes in them
+        if (scrolled) {
+            error = gc9a01_write_rect(dev, x, gram_row, &part, part_buf);
+        } else {
+            error = gc9a01_write_clipped(dev, x, gram_row, &part, part_buf);
+        }
+        row += rows;
+    }
+
+    return error;
 }
 
 static int gc9a01_write(const struct device *dev, const uint16_t x, const uint16_t y,
                         const struct display_buffer_descriptor *desc,
                         const void *buf)
 {
-#ifdef GC9A01_SPI_PROFILING
-    uint32_t start_time;
-    uint32_t stop_time;
-    uint32_t cycles_spent;
-    uint32_t nanoseconds_spent;
+    struct gc9a01_data *data = dev->data;
+    int error;
+
+    gc9a01_lock(dev);
+    gc9a01_trace_flush_begin(x, y, desc->width, desc->height);
+
+#if GC9A01_HAS_TE
+    gc9a01_te_wait(dev, y, desc);
 #endif
-    uint16_t x_end_idx = x + desc->width - 1;
-    uint16_t y_end_idx = y + desc->height - 1;
 
-    frame.start.X = x;
-    frame.end.X = x_end_idx;
-    frame.start.Y = y;
-    frame.end.Y = y_end_idx;
-    gc9a01_set_frame(dev, frame);
+#ifdef CONFIG_GC9A01_STATS
+    gc9a01_stats_flush_begin(data, desc);
+#endif
 
-    size_t len = (x_end_idx + 1 - x) * (y_end_idx + 1 - y) * 16 / 8;
-    //printk("x_start: %d, y_start: %d, x_end: %d, y_end: %d, buf_size: %d, pitch: %d len: %d\n", x, y, x_end_idx, y_end_idx, desc->buf_size, desc->pitch, len);
+    if (data->scroll_rows != 0) {
+        error = gc9a01_write_scrolled(dev, x, y, desc, buf);
+    } else {
+        error = gc9a01_write_clipped(dev, x, y, desc, buf);
+    }
 
-#ifdef GC9A01_SPI_PROFILING
-    start_time = k_cycle_get_32();
+#ifdef CONFIG_GC9A01_STATS
+    gc9a01_flush_cb_t flush_cb = NULL;
+    void *flush_user_data = NULL;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+    // Still on the wire, the completion callback closes the flush out
+    if (k_sem_count_get(&data->tx_idle) == 0) {
+        data->flush_end_pending = true;
+    } else {
+        flush_cb = gc9a01_stats_flush_close(data, &flush_user_data);
+    }
+#else
+    flush_cb = gc9a01_stats_flush_close(data, &flush_user_data);
 #endif
-    gc9a01_write_cmd(dev, GC9A01A_RAMWR, buf, len);
-#ifdef GC9A01_SPI_PROFILING
-    stop_time = k_cycle_get_32();
-    cycles_spent = stop_time - start_time;
-    nanoseconds_spent = k_cyc_to_ns_ceil32(cycles_spent);
-    printf("%d =>: %dns\n", len, nanoseconds_spent);
-    LOG_DBG("%d =>: %dns", len, nanoseconds_spent);
+    k_spin_unlock(&data->stats_lock, key);
+
+    if (flush_cb != NULL) {
+        flush_cb(dev, GC9A01_FLUSH_END, flush_user_data);
+    }
 #endif
 
+    gc9a01_trace_flush_end();
+    k_mutex_unlock(&data->lock);
+
+    return error;
+}
+
+int gc9a01_flush_callback_set(const struct device *dev, gc9a01_flush_cb_t cb, void *user_data)
+{
+#ifdef CONFIG_GC9A01_STATS
+    struct gc9a01_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->flush_user_data = user_data;
+    data->flush_cb = cb;
+    k_spin_unlock(&data->stats_lock, key);
+
     return 0;
+#else
+    return -ENOTSUP;
+#endif
+}
+
+#ifdef CONFIG_GC9A01_STATS
+void gc9a01_stats_get(const struct device *dev, struct gc9a01_stats *stats)
+{
+    struct gc9a01_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    *stats = data->stats;
+    k_spin_unlock(&data->stats_lock, key);
 }
 
+void gc9a01_stats_reset(const struct device *dev)
+{
+    struct gc9a01_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    memset(&data->stats, 0, sizeof(data->stats));
+    k_spin_unlock(&data->stats_lock, key);
+}
+
+uint32_t gc9a01_stats_kbps(const struct gc9a01_stats *stats)
+{
+    uint64_t us = k_cyc_to_us_floor64(stats->cycles);
+
+    if (us == 0) return 0;
+    // Bytes per microsecond is MB/s, keep three decimals of it
+    return (uint32_t) ((stats->bytes * 1000U) / us);
+}
+#endif // CONFIG_GC9A01_STATS
+
 static int gc9a01_read(const struct device *dev, const uint16_t x, const uint16_t y,
                        const struct display_buffer_descriptor *desc, void *buf)
 {
@@ -302,6 +1091,7 @@ static int gc9a01_set_brightness(const struct device *dev,
                                  const uint8_t brightness)
 {
     const struct gc9a01_config *config = dev->config;
+    gc9a01_trace_brightness(brightness);
     pwm_set_dt(&config->bl_pwm, config->bl_pwm.period, (uint32_t) ((brightness / 255.0) * config->bl_pwm.period));
     return 0;
 }
@@ -318,6 +1108,7 @@ static void gc9a01_get_capabilities(const struct device *dev,
     memset(caps, 0, sizeof(struct display_capabilities));
     caps->x_resolution = DISPLAY_WIDTH;
     caps->y_resolution = DISPLAY_HEIGHT;
+    // With CONFIG_GC9A01_COLOR_12BIT this is still what callers hand us, the driver packs it down
     caps->supported_pixel_formats = PIXEL_FORMAT_BGR_565;
     caps->current_pixel_format = PIXEL_FORMAT_BGR_565;
     caps->screen_info = SCREEN_INFO_MONO_MSB_FIRST;
@@ -337,34 +1128,116 @@ static int gc9a01_set_pixel_format(const struct device *dev,
     return -ENOTSUP;
 }
 
-static int gc9a01_controller_init(const struct device *dev)
+// Controller bring-up, runs on the driver's work queue so nobody waits out the reset.
+// The init table goes out back to back with CS held low and the bus locked, up to the next entry
+//  with a delay after it. The bus is released and the work item comes back once the delay is
+//  over, so the BMA400 and the flash on the same SPI bus are never shut out for longer than it
+//  takes to clock a run of commands out. Sleep out also waits for the 120 ms after reset.
+static void gc9a01_init_work_handler(struct k_work *work)
 {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct gc9a01_data *data = CONTAINER_OF(dwork, struct gc9a01_data, init_work);
+    const struct device *dev = data->dev;
     const struct gc9a01_config *config = dev->config;
+    const GC9A01A_init_cmd_t *entry;
+    int64_t now;
+    int32_t wait = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    data->spi_cfg = &data->batch_cfg;
+    for (entry = &GC9A01A_init_cmds[data->init_step]; entry->databytes != 0xff; entry++) {
+        now = k_uptime_get();
+        if (entry->cmd == SLPOUT && now < data->toggle_ready_at) {
+            wait = (int32_t) (data->toggle_ready_at - now);
+            break;
+        }
 
-    LOG_DBG("Initialize GC9A01 controller");
+        gc9a01_write_cmd(dev, entry->cmd, entry->data, entry->databytes);
+        data->init_step++;
+
+        if (entry->cmd == SLPOUT) {
+            now = k_uptime_get();
+            data->asleep = false;
+            data->want_asleep = false;
+            data->cmd_ready_at = now + GC9A01_SLEEP_CMD_SETTLE_MS;
+            data->toggle_ready_at = now + GC9A01_SLEEP_TOGGLE_SETTLE_MS;
+        }
+        if (entry->delay_ms != 0) {
+            wait = entry->delay_ms;
+            break;
+        }
+    }
+    spi_release(config->bus.bus, &data->batch_cfg);
+    data->spi_cfg = &config->bus.config;
 
+    if (wait > 0) {
+        k_mutex_unlock(&data->lock);
+        k_work_schedule_for_queue(&gc9a01_workq, &data->init_work, K_MSEC(wait));
+        return;
+    }
+
+    data->initialized = true;
+    k_sem_give(&data->init_done);
+
+    k_mutex_unlock(&data->lock);
+
+    LOG_DBG("GC9A01 controller ready");
+}
+
+// Pulse reset and queue the rest of the bring-up, returns right away
+static void gc9a01_controller_init(const struct device *dev)
+{
+    const struct gc9a01_config *config = dev->config;
+    struct gc9a01_data *data = dev->data;
+    int64_t now;
+
+    // Reset only has to be held for 10 us
     gpio_pin_set_dt(&config->reset_gpio, 0);
-    k_msleep(5);
+    k_busy_wait(20);
     gpio_pin_set_dt(&config->reset_gpio, 1);
-    k_msleep(150);
+    gc9a01_frame_invalidate();
 
-    int cmd = 0;
-    while (GC9A01A_init_cmds[cmd].databytes != 0xff)
-    {
-        gc9a01_write_cmd(dev, GC9A01A_init_cmds[cmd].cmd, GC9A01A_init_cmds[cmd].data, GC9A01A_init_cmds[cmd].databytes);
-        k_msleep(GC9A01A_init_cmds[cmd].delay_ms);
-        cmd++;
-    }
+    // Coming out of reset the controller is asleep, same settle rules as a sleep in
+    now = k_uptime_get();
+    data->asleep = true;
+    data->want_asleep = true;
+    data->cmd_ready_at = now + GC9A01_SLEEP_CMD_SETTLE_MS;
+    data->toggle_ready_at = now + GC9A01_SLEEP_TOGGLE_SETTLE_MS;
 
-    return 0;
+    data->init_step = 0;
+    LOG_DBG("Initialize GC9A01 controller");
+    k_work_schedule_for_queue(&gc9a01_workq, &data->init_work, K_MSEC(GC9A01_SLEEP_CMD_SETTLE_MS));
 }
 
 static int gc9a01_init(const struct device *dev)
 {
     const struct gc9a01_config *config = dev->config;
+    struct gc9a01_data *data = dev->data;
 
     LOG_DBG("");
 
+    data->dev = dev;
+    k_work_queue_start(&gc9a01_workq, gc9a01_workq_stack, K_THREAD_STACK_SIZEOF(gc9a01_workq_stack),
+                       CONFIG_SYSTEM_WORKQUEUE_PRIORITY, NULL);
+    k_mutex_init(&data->lock);
+    k_work_init_delayable(&data->sleep_work, gc9a01_sleep_work_handler);
+    k_work_init_delayable(&data->init_work, gc9a01_init_work_handler);
+    k_sem_init(&data->init_done, 0, 1);
+    data->spi_cfg = &config->bus.config;
+    data->batch_cfg = config->bus.config;
+    data->batch_cfg.operation |= SPI_HOLD_ON_CS | SPI_LOCK_ON;
+    gc9a01_trace_init(config->bus.config.frequency);
+
+#ifdef CONFIG_GC9A01_FLUSH_ASYNC
+    k_sem_init(&data->tx_idle, 1, 1);
+    data->tx_buf_set.buffers = data->tx_bufs;
+    data->tx_buf_set.count = 1;
+#endif
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    gc9a01_round_mask_init(data);
+#endif
+
     if (!spi_is_ready_dt(&config->bus)) {
         LOG_ERR("SPI bus %s not ready", config->bus.bus->name);
         return -ENODEV;
@@ -382,7 +1255,19 @@ static int gc9a01_init(const struct device *dev)
 
     gpio_pin_configure_dt(&config->reset_gpio, GPIO_OUTPUT_ACTIVE);
     gpio_pin_configure_dt(&config->dc_gpio, GPIO_OUTPUT_INACTIVE);
-    k_msleep(500);
+
+#if GC9A01_HAS_TE
+    if (!gpio_is_ready_dt(&config->te_gpio)) {
+        LOG_ERR("TE GPIO device not ready");
+        return -ENODEV;
+    }
+
+    k_sem_init(&data->te_sem, 0, 1);
+    gpio_pin_configure_dt(&config->te_gpio, GPIO_INPUT);
+    gpio_init_callback(&data->te_cb, gc9a01_te_isr, BIT(config->te_gpio.pin));
+    gpio_add_callback_dt(&config->te_gpio, &data->te_cb);
+    gpio_pin_interrupt_configure_dt(&config->te_gpio, GPIO_INT_EDGE_TO_ACTIVE);
+#endif
 
 	if (!device_is_ready(config->bl_pwm.dev)) {
 		LOG_ERR("Backlight PWM device not ready");
@@ -407,8 +1292,13 @@ static const struct gc9a01_config gc9a01_config = {
     .reset_gpio = GPIO_DT_SPEC_INST_GET(0, reset_gpios),
     .dc_gpio = GPIO_DT_SPEC_INST_GET(0, dc_gpios),
     .bl_pwm = PWM_DT_SPEC_GET(DT_NODELABEL(gc9a01)),
+#if GC9A01_HAS_TE
+    .te_gpio = GPIO_DT_SPEC_INST_GET(0, te_gpios),
+#endif
 };
 
+static struct gc9a01_data gc9a01_data;
+
 static struct display_driver_api gc9a01_driver_api = {
     .blanking_on = gc9a01_blanking_on,
     .blanking_off = gc9a01_blanking_off,
@@ -422,8 +1312,46 @@ static struct display_driver_api gc9a01_driver_api = {
     .set_orientation = gc9a01_set_orientation,
 };
 
-DEVICE_DT_INST_DEFINE(0, gc9a01_init, NULL, NULL, &gc9a01_config, POST_KERNEL,
+DEVICE_DT_INST_DEFINE(0, gc9a01_init, NULL, &gc9a01_data, &gc9a01_config, POST_KERNEL,
                       CONFIG_DISPLAY_INIT_PRIORITY, &gc9a01_driver_api);
 
+#if defined(CONFIG_GC9A01_STATS) && defined(CONFIG_SHELL)
+static int cmd_gc9a01_stats(const struct shell *sh, size_t argc, char **argv)
+{
+    const struct device *dev = DEVICE_DT_GET(DT_DRV_INST(0));
+    struct gc9a01_stats stats;
+    uint32_t kbps;
+
+    gc9a01_stats_get(dev, &stats);
+    kbps = gc9a01_stats_kbps(&stats);
+
+    shell_print(sh, "flushes:    %u", stats.flushes);
+    shell_print(sh, "bytes:      %llu (%llu unclipped)", stats.bytes, stats.rect_bytes);
+    shell_print(sh, "time:       %llu us total, %u us max",
+                k_cyc_to_us_floor64(stats.cycles), k_cyc_to_us_floor32(stats.max_cycles));
+    shell_print(sh, "throughput: %u.%03u MB/s", kbps / 1000, kbps % 1000);
+    for (int i = 0; i < GC9A01_STATS_AREA_BUCKETS; i++) {
+        if (i == GC9A01_STATS_AREA_BUCKETS - 1) {
+            shell_print(sh, "  >= %5u px: %u", 256U << (2 * (i - 1)), stats.area_hist[i]);
+        } else {
+            shell_print(sh, "  <  %5u px: %u", 256U << (2 * i), stats.area_hist[i]);
+        }
+    }
 
+    return 0;
+}
+
+static int cmd_gc9a01_stats_reset(const struct shell *sh, size_t argc, char **argv)
+{
+    gc9a01_stats_reset(DEVICE_DT_GET(DT_DRV_INST(0)));
 
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_gc9a01,
+    SHELL_CMD(stats, NULL, "Print flush statistics", cmd_gc9a01_stats),
+    SHELL_CMD(reset, NULL, "Clear flush statistics", cmd_gc9a01_stats_reset),
+    SHELL_SUBCMD_SET_END
+);
+SHELL_CMD_REGISTER(gc9a01, &sub_gc9a01, "GC9A01 display driver", NULL);
+#endif
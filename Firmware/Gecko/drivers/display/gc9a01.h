@@ -0,0 +1,59 @@
+#ifndef __GC9A01_H__
+#define __GC9A01_H__
+
+#include <stdint.h>
+#include <zephyr/device.h>
+
+#define GC9A01_STATS_AREA_BUCKETS   5
+
+// Flush counters, times are in hardware cycles (k_cycle_get_32) and cover a flush from the
+//  display_write() call until its last byte is off the wire
+struct gc9a01_stats {
+    uint32_t flushes;
+    uint64_t bytes;         // Pixel bytes actually sent
+    uint64_t rect_bytes;    // What the flushed areas would cost sent whole at 16 bpp
+    uint64_t cycles;
+    uint32_t max_cycles;
+    // Flush areas in pixels: < 256, < 1k, < 4k, < 16k and anything bigger
+    uint32_t area_hist[GC9A01_STATS_AREA_BUCKETS];
+};
+
+// Called from the TE interrupt at the start of every panel refresh, keep it short
+typedef void (*gc9a01_vsync_cb_t)(const struct device *dev, void *user_data);
+
+// Register (or clear with NULL) the vsync callback, -ENOTSUP when the board has no te-gpios
+int gc9a01_vsync_callback_set(const struct device *dev, gc9a01_vsync_cb_t cb, void *user_data);
+
+// Always-on mode: only rows start_row..end_row are driven (partial mode) and colors drop to the
+//  8 the controller can show with each channel on or off (idle mode), for a low power glance screen
+int gc9a01_always_on_enter(const struct device *dev, uint16_t start_row, uint16_t end_row);
+int gc9a01_always_on_exit(const struct device *dev);
+
+// Hardware vertical scroll. Rows top_fixed..top_fixed + scroll_rows - 1 become a ring the panel
+//  can rotate without new pixel data, scroll_rows of 0 turns it back off. Writes keep using
+//  screen coordinates, the driver sends them to wherever those rows currently sit in GRAM.
+int gc9a01_scroll_area_set(const struct device *dev, uint16_t top_fixed, uint16_t scroll_rows);
+// Show the scroll area starting offset rows further down its content
+int gc9a01_scroll_to(const struct device *dev, uint16_t offset);
+
+// Flush edges as the stats see them: BEGIN once the pixels start going out, END once the last byte
+//  is off the wire. END may come from the SPI completion interrupt, keep it short.
+enum gc9a01_flush_event {
+    GC9A01_FLUSH_BEGIN,
+    GC9A01_FLUSH_END,
+};
+
+typedef void (*gc9a01_flush_cb_t)(const struct device *dev, enum gc9a01_flush_event event, void *user_data);
+
+// Register (or clear with NULL) the flush callback, -ENOTSUP without CONFIG_GC9A01_STATS
+int gc9a01_flush_callback_set(const struct device *dev, gc9a01_flush_cb_t cb, void *user_data);
+
+#ifdef CONFIG_GC9A01_STATS
+void gc9a01_stats_get(const struct device *dev, struct gc9a01_stats *stats);
+void gc9a01_stats_reset(const struct device *dev);
+
+// Effective throughput of the flushes so far in kB/s (thousandths of a MB/s)
+uint32_t gc9a01_stats_kbps(const struct gc9a01_stats *stats);
+#endif
+
+#endif
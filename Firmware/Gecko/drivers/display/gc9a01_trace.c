@@ -0,0 +1,197 @@
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "gc9a01_trace.h"
+
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+#define MEM_WR              0x2C
+#define MEM_WR_CONT         0x3C
+
+// Longest a varint of a 32-bit value gets
+#define VARINT_MAX          5
+
+#define DUMP_LINE_BYTES     32
+
+static uint8_t trace_buf[CONFIG_GC9A01_TRACE_BUFFER_SIZE];
+static size_t trace_len = GC9A01_TRACE_HEADER_SIZE;
+static uint32_t trace_dropped;
+static uint32_t trace_spi_hz;
+static uint32_t trace_last;         // Cycle count of the record before
+static uint8_t trace_last_cmd;
+static bool trace_active = true;
+static struct k_spinlock trace_lock;
+
+static size_t trace_varint(uint8_t *dst, uint32_t value)
+{
+    size_t len = 0;
+
+    while (value >= 0x80) {
+        dst[len++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    dst[len++] = value;
+
+    return len;
+}
+
+// Append one record, the payload is already encoded. Full means every record from here on is dropped,
+//  even small ones, so the trace never has holes in it.
+static void trace_put(uint8_t type, const uint8_t *payload, size_t len)
+{
+    k_spinlock_key_t key = k_spin_lock(&trace_lock);
+    uint32_t now = k_cycle_get_32();
+
+    if (!trace_active) {
+        k_spin_unlock(&trace_lock, key);
+        return;
+    }
+
+    if (trace_dropped || trace_len + 1 + VARINT_MAX + len > sizeof(trace_buf)) {
+        trace_dropped++;
+        k_spin_unlock(&trace_lock, key);
+        return;
+    }
+
+    trace_buf[trace_len++] = type;
+    trace_len += trace_varint(&trace_buf[trace_len], k_cyc_to_us_floor32(now - trace_last));
+    memcpy(&trace_buf[trace_len], payload, len);
+    trace_len += len;
+    trace_last = now;
+
+    k_spin_unlock(&trace_lock, key);
+}
+
+void gc9a01_trace_init(uint32_t spi_hz)
+{
+    trace_spi_hz = spi_hz;
+    gc9a01_trace_start();
+}
+
+void gc9a01_trace_cmd(uint8_t cmd)
+{
+    trace_last_cmd = cmd;
+    trace_put(GC9A01_TRACE_CMD, &cmd, 1);
+}
+
+void gc9a01_trace_data(const uint8_t *data, size_t len, bool async)
+{
+    uint8_t payload[VARINT_MAX + GC9A01_TRACE_DATA_MAX];
+    size_t size = trace_varint(payload, len);
+
+    // Command parameters are kept so windows and modes can be followed, pixels only by their size
+    if (trace_last_cmd != MEM_WR && trace_last_cmd != MEM_WR_CONT && len <= GC9A01_TRACE_DATA_MAX) {
+        memcpy(&payload[size], data, len);
+        size += len;
+    }
+
+    trace_put(GC9A01_TRACE_DATA | (async ? GC9A01_TRACE_ASYNC : 0), payload, size);
+}
+
+void gc9a01_trace_flush_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    uint8_t payload[4 * VARINT_MAX];
+    size_t size = 0;
+
+    size += trace_varint(&payload[size], x);
+    size += trace_varint(&payload[size], y);
+    size += trace_varint(&payload[size], width);
+    size += trace_varint(&payload[size], height);
+    trace_put(GC9A01_TRACE_FLUSH_BEGIN, payload, size);
+}
+
+void gc9a01_trace_flush_end(void)
+{
+    trace_put(GC9A01_TRACE_FLUSH_END, NULL, 0);
+}
+
+void gc9a01_trace_brightness(uint8_t level)
+{
+    trace_put(GC9A01_TRACE_BRIGHTNESS, &level, 1);
+}
+
+void gc9a01_trace_start(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&trace_lock);
+
+    trace_len = GC9A01_TRACE_HEADER_SIZE;
+    trace_dropped = 0;
+    trace_last = k_cycle_get_32();
+    trace_active = true;
+
+    k_spin_unlock(&trace_lock, key);
+}
+
+void gc9a01_trace_stop(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&trace_lock);
+
+    trace_active = false;
+    k_spin_unlock(&trace_lock, key);
+}
+
+size_t gc9a01_trace_get(const uint8_t **trace)
+{
+    k_spinlock_key_t key = k_spin_lock(&trace_lock);
+    size_t len = trace_len;
+
+    memcpy(trace_buf, "GTRC", 4);
+    trace_buf[4] = GC9A01_TRACE_VERSION;
+    memset(&trace_buf[5], 0, 3);
+    sys_put_le32(trace_spi_hz, &trace_buf[8]);
+    sys_put_le32(len - GC9A01_TRACE_HEADER_SIZE, &trace_buf[12]);
+    sys_put_le32(trace_dropped, &trace_buf[16]);
+    k_spin_unlock(&trace_lock, key);
+
+    *trace = trace_buf;
+    return len;
+}
+
+void gc9a01_trace_dump(void)
+{
+    const uint8_t *trace;
+    size_t len = gc9a01_trace_get(&trace);
+
+    printf("gc9a01 trace, %u bytes, %u dropped:\n", (unsigned int) len, trace_dropped);
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", trace[i]);
+        if ((i + 1) % DUMP_LINE_BYTES == 0 || i + 1 == len) printf("\n");
+    }
+    printf("gc9a01 trace end\n");
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_gc9a01_trace_start(const struct shell *sh, size_t argc, char **argv)
+{
+    gc9a01_trace_start();
+
+    return 0;
+}
+
+static int cmd_gc9a01_trace_stop(const struct shell *sh, size_t argc, char **argv)
+{
+    gc9a01_trace_stop();
+
+    return 0;
+}
+
+static int cmd_gc9a01_trace_dump(const struct shell *sh, size_t argc, char **argv)
+{
+    gc9a01_trace_stop();
+    gc9a01_trace_dump();
+
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_gc9a01_trace,
+    SHELL_CMD(start, NULL, "Clear the trace and record again", cmd_gc9a01_trace_start),
+    SHELL_CMD(stop, NULL, "Stop recording", cmd_gc9a01_trace_stop),
+    SHELL_CMD(dump, NULL, "Stop recording and print the trace as hex", cmd_gc9a01_trace_dump),
+    SHELL_SUBCMD_SET_END
+);
+SHELL_CMD_REGISTER(gc9a01_trace, &sub_gc9a01_trace, "Display bus trace", NULL);
+#endif
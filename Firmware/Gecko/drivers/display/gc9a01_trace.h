@@ -0,0 +1,79 @@
+#ifndef __GC9A01_TRACE_H__
+#define __GC9A01_TRACE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+    Display bus recorder, CONFIG_GC9A01_TRACE. Both the gc9a01 driver and the legacy GC9A01A.c
+    log every command and data transfer they put on the bus into a RAM buffer, so a real session
+    can be replayed on the host with "Software Tools/Trace Replay" against a different SPI clock
+    or driver setup. Recording starts at boot and stops once the buffer is full.
+
+    Trace layout, little endian:
+        char     magic[4]           "GTRC"
+        uint8_t  version            GC9A01_TRACE_VERSION
+        uint8_t  reserved[3]
+        uint32_t spi_hz             Bus clock the trace was taken at
+        uint32_t length             Bytes of records that follow the header
+        uint32_t dropped            Records that no longer fit
+
+    Every record is a type byte, the microseconds since the record before as a varint (7 bits per
+    byte, low first, top bit set on all but the last) and then:
+        CMD             uint8_t cmd
+        DATA            varint len, then the bytes themselves unless they are pixels (the
+                        command before was RAMWR or MEM_WR_CONT) or longer than GC9A01_TRACE_DATA_MAX
+        FLUSH_BEGIN     varint x, y, width, height of the area handed to display_write()
+        FLUSH_END       display_write() returned, with async flushes the last transfer can
+                        still be on the wire
+        BRIGHTNESS      uint8_t backlight level, 0-255
+    GC9A01_TRACE_ASYNC is or'ed into the type of a DATA record the CPU didn't wait on. A record is
+    stamped when the driver asks for the transfer, before any wait for the bus, so the replay can
+    work out the waits itself. Times are only as fine as k_cycle_get_32(), about 30 us on the nRF52.
+*/
+
+#define GC9A01_TRACE_VERSION        1
+#define GC9A01_TRACE_HEADER_SIZE    20
+#define GC9A01_TRACE_DATA_MAX       8
+
+#define GC9A01_TRACE_CMD            0x01
+#define GC9A01_TRACE_DATA           0x02
+#define GC9A01_TRACE_FLUSH_BEGIN    0x03
+#define GC9A01_TRACE_FLUSH_END      0x04
+#define GC9A01_TRACE_BRIGHTNESS     0x05
+#define GC9A01_TRACE_ASYNC          0x80
+
+#ifdef CONFIG_GC9A01_TRACE
+
+// Called by the driver once it knows its bus clock, clears anything recorded so far
+void gc9a01_trace_init(uint32_t spi_hz);
+
+void gc9a01_trace_cmd(uint8_t cmd);
+void gc9a01_trace_data(const uint8_t *data, size_t len, bool async);
+void gc9a01_trace_flush_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void gc9a01_trace_flush_end(void);
+void gc9a01_trace_brightness(uint8_t level);
+
+// Throw away what was recorded and start over, or pause recording
+void gc9a01_trace_start(void);
+void gc9a01_trace_stop(void);
+
+// The whole trace, header included, e.g. to copy it out to the external flash. Stop first.
+size_t gc9a01_trace_get(const uint8_t **trace);
+
+// Print the trace as hex lines for trace_replay.py to read back from a console log
+void gc9a01_trace_dump(void);
+
+#else
+
+static inline void gc9a01_trace_init(uint32_t spi_hz) {}
+static inline void gc9a01_trace_cmd(uint8_t cmd) {}
+static inline void gc9a01_trace_data(const uint8_t *data, size_t len, bool async) {}
+static inline void gc9a01_trace_flush_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {}
+static inline void gc9a01_trace_flush_end(void) {}
+static inline void gc9a01_trace_brightness(uint8_t level) {}
+
+#endif // CONFIG_GC9A01_TRACE
+
+#endif // __GC9A01_TRACE_H__
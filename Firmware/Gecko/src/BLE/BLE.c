@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <string.h>
 
 #include <zephyr/kernel.h>
 #include <zephyr/bluetooth/bluetooth.h>
@@ -12,20 +13,20 @@
 #include "clock.h"
 #include "BLE.h"
 
-static char stringBuffer[512]; // To hold notification transfer, the max characteristic size is 512
 volatile bool bluetoothConnected = false;
 
 // We should be using a linked list for this but brute force an array for now
-// This buffer will be managed as a ring buffer
+// Kept sorted newest first by timestamp, the display shows them in this order
 Notification activeNotifications[MAX_NOTIFICATION_COUNT];
 uint8_t notificationCount = 0;
-static uint8_t nextNotificationIndex = 0;
+uint32_t notificationRevision = 0; // Bumped on every add/remove so the display can tell if it is out of date
+static uint32_t nextNotificationId = 1;
 
 void clearNotifications(void)
 {
     // We're not worried about securely deleting the notification data, just leave it and mark it unused
     notificationCount = 0;
-    nextNotificationIndex = 0;
+    notificationRevision++;
 }
 
 void clearNotification(uint8_t notificationIndex)
@@ -45,10 +46,36 @@ void clearNotification(uint8_t notificationIndex)
 
         // We removed a notification and now there is a empty spot at the end
         notificationCount--;
-        nextNotificationIndex = notificationCount;
+        notificationRevision++;
     }
 }
 
+// Index of the notification with this id, -1 if it has been cleared
+int8_t findNotification(uint32_t id)
+{
+    for (int i = 0; i < notificationCount; i++)
+    {
+        if (activeNotifications[i].id == id) return i;
+    }
+    return -1;
+}
+
+// Insert in timestamp order (ties go in front, they arrived later), dropping the oldest when full
+static void addNotification(const Notification* notification)
+{
+    uint8_t index = 0;
+
+    while (index < notificationCount && activeNotifications[index].timestamp > notification->timestamp) index++;
+    if (index == MAX_NOTIFICATION_COUNT) return; // Full and older than all of them
+
+    if (notificationCount == MAX_NOTIFICATION_COUNT) notificationCount--;
+    memmove(&activeNotifications[index + 1], &activeNotifications[index], (notificationCount - index) * sizeof(Notification));
+    activeNotifications[index] = *notification;
+    activeNotifications[index].id = nextNotificationId++;
+    notificationCount++;
+    notificationRevision++;
+}
+
 /* 
 --------------- START OF ADVERTISING SETUP --------------- 
 */
@@ -82,40 +109,100 @@ static float app_battery_level_cb(void) {
     return 2.22;
 }
 
+// Copy a text field over, cut to fit and terminated
+static void copyNotificationField(char* dst, size_t size, const uint8_t* value, uint16_t len)
+{
+    if (len >= size) len = size - 1;
+    memcpy(dst, value, len);
+    dst[len] = '\0';
+}
+
+static uint64_t readNotificationNumber(const uint8_t* value, uint16_t len)
+{
+    uint64_t number = 0;
+    for (int i = 0; i < len && i < 8; i++)
+    {
+        number = (number << 8) | value[i];
+    }
+    return number;
+}
+
 static void app_notification_cb(char* notification, int len) {
-    char* splitIndex;
+    const uint8_t* payload = (const uint8_t*) notification;
+    // Static, a whole Notification is too big for the BT RX thread's stack. Only that thread calls in.
+    static Notification incoming;
+    int8_t previous;
+    int pos = 1;
 
-    // There is no null terminator but need it to parse so copy string into buffer and add it
-    for (int i = 0; i < len; i++){
-        stringBuffer[i] = notification[i];
+    memset(&incoming, 0, sizeof(incoming));
+
+    if (len < 1 || payload[0] != SWS_NOTIFICATION_VERSION)
+    {
+        printf("Notification dropped, version %d\r\n", len < 1 ? -1 : payload[0]);
+        return;
     }
-    stringBuffer[len] = '\0';
 
-    printf("%s\n", stringBuffer);
+    // Fields are read straight out of the GATT buffer, see SmartWatchService.h for the layout
+    while (pos < len)
+    {
+        if (pos + SWS_FIELD_HEADER_SIZE > len)
+        {
+            printf("Notification dropped, field at %d runs past the end\r\n", pos);
+            return;
+        }
 
-    // Read in app name
-    splitIndex = strtok(stringBuffer, ":");
-    strncpy(activeNotifications[notificationCount].appName, splitIndex, 64);
+        uint8_t type = payload[pos];
+        uint16_t fieldLen = (payload[pos + 1] << 8) | payload[pos + 2];
+        const uint8_t* value = &payload[pos + SWS_FIELD_HEADER_SIZE];
 
-    // Read in title
-    splitIndex = strtok(NULL, ":");
-    strncpy(activeNotifications[notificationCount].title, splitIndex, 64);
+        if (pos + SWS_FIELD_HEADER_SIZE + fieldLen > len)
+        {
+            printf("Notification dropped, field at %d runs past the end\r\n", pos);
+            return;
+        }
 
-    // Read in text
-    splitIndex = strtok(NULL, ":");
-    strncpy(activeNotifications[notificationCount].text, splitIndex, 256);
+        switch (type)
+        {
+            case SWS_FIELD_APP:
+                copyNotificationField(incoming.appName, sizeof(incoming.appName), value, fieldLen);
+                break;
+            case SWS_FIELD_TITLE:
+                copyNotificationField(incoming.title, sizeof(incoming.title), value, fieldLen);
+                break;
+            case SWS_FIELD_BODY:
+                copyNotificationField(incoming.text, sizeof(incoming.text), value, fieldLen);
+                break;
+            case SWS_FIELD_TIMESTAMP:
+                incoming.timestamp = (time_t) readNotificationNumber(value, fieldLen);
+                break;
+            case SWS_FIELD_ID:
+                incoming.sourceId = (uint32_t) readNotificationNumber(value, fieldLen);
+                break;
+            default:
+                break;
+        }
+        pos += SWS_FIELD_HEADER_SIZE + fieldLen;
+    }
 
-    // Read in timestamp
-    splitIndex = strtok(NULL, ":");
-    activeNotifications[notificationCount].timestamp = (time_t) strtoull(splitIndex, NULL, 10);
+    printf("Received and read in notification: %s, %s, %s, %lld\r\n", incoming.appName,
+                                                                      incoming.title,
+                                                                      incoming.text,
+                                                                      (long long) incoming.timestamp);
 
-    printf("Received and read in notification: %s, %s, %s, %lld\r\n", activeNotifications[notificationCount].appName,
-                                                                      activeNotifications[notificationCount].title,
-                                                                      activeNotifications[notificationCount].text,
-                                                                      activeNotifications[notificationCount].timestamp);
+    // An update to one the watch already has replaces it rather than stacking up
+    if (incoming.sourceId != 0)
+    {
+        for (previous = 0; previous < notificationCount; previous++)
+        {
+            if (activeNotifications[previous].sourceId == incoming.sourceId)
+            {
+                clearNotification(previous);
+                break;
+            }
+        }
+    }
 
-    nextNotificationIndex = (nextNotificationIndex + 1) % 5;
-    notificationCount++;
+    addNotification(&incoming);
 
     // Alert the user inteface that a new notification has appeared
 	k_event_post(&userInteractionEvent, SYSTEM_EVENT_NEW_NOTIFICATION);
@@ -132,7 +219,7 @@ static void app_update_time_cb(char* time, int len) {
     // Any time zone or daylight savings time will be implemented on host
     setEpochTime(epochTime);
 
-    printf("Synced time to: %llu\r\n", epochTime);
+    printf("Synced time to: %llu\r\n", (unsigned long long) epochTime);
 }
 
 static struct SmartWatchService_cb my_SmartWatchService_cbs = {
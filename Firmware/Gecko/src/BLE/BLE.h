@@ -3,19 +3,24 @@
 
 #define MAX_NOTIFICATION_COUNT  5
 #define MAX_LENGTH_APP_NAME     64
+#define MAX_LENGTH_BODY         384 // Anything longer would not fit in a notification payload anyway
 
 typedef struct Notification {
     char appName[MAX_LENGTH_APP_NAME];
     char title[64];
-    char text[256];
+    char text[MAX_LENGTH_BODY];
     time_t timestamp;
+    uint32_t id;    // Unique for as long as the watch is up, survives the array being reshuffled
+    uint32_t sourceId;  // Id the phone gave it, 0 if it didn't send one
 } Notification;
 
 int BLE_init(void);
 void clearNotifications(void);
 void clearNotification(uint8_t notificationIndex);
+int8_t findNotification(uint32_t id);
 
 extern Notification activeNotifications[5];
 extern uint8_t notificationCount;
+extern uint32_t notificationRevision;
 
 #endif // __BLE__H
\ No newline at end of file
@@ -17,6 +17,12 @@
 static struct SmartWatchService_cb  app_SmartWatchService_cbs;
 static float battery_level = 0.0;
 
+// A notification bigger than one MTU arrives as a long write (prepared writes, then an execute) and
+//  the stack hands it over in chunks, it is put back together here before the app sees it
+static uint8_t notification_payload[SWS_NOTIFICATION_MAX_SIZE];
+static uint16_t notification_expected;  // Length of the whole write, from the prepared chunks
+static uint16_t notification_received;
+
 static ssize_t battery_level_read_callback(
     struct bt_conn* conn,
     const struct bt_gatt_attr* attr,
@@ -46,11 +52,36 @@ static ssize_t notification_write_callback(
     uint16_t offset,
     uint8_t flags
 ){
-    // The buf input should contain what the write was
-    char* val = (char*) buf;
+    if (offset + len > sizeof(notification_payload)) {
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_ATTRIBUTE_LEN);
+    }
+
+    // Prepared chunks are only checked here, the stack queues them and writes them on the execute.
+    //  Going by them is the only way to know how long the whole write will be.
+    if (flags & BT_GATT_WRITE_FLAG_PREPARE) {
+        if (offset == 0) notification_expected = 0;
+        if (offset + len > notification_expected) notification_expected = offset + len;
+        return 0;
+    }
+
+    // A plain write is the whole payload
+    if (!(flags & BT_GATT_WRITE_FLAG_EXECUTE)) notification_expected = len;
+
+    if (offset == 0) notification_received = 0;
+    if (offset != notification_received) {
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+    }
+
+    memcpy(&notification_payload[offset], buf, len);
+    notification_received = offset + len;
 
-    if (app_SmartWatchService_cbs.notification_cb){
-        app_SmartWatchService_cbs.notification_cb(val, len);
+    // Depending on the Zephyr version the execute comes as one write or chunk by chunk
+    if (notification_received >= notification_expected) {
+        if (app_SmartWatchService_cbs.notification_cb){
+            app_SmartWatchService_cbs.notification_cb((char*) notification_payload, notification_received);
+        }
+        notification_expected = 0;
+        notification_received = 0;
     }
 
     return len;
@@ -89,7 +120,7 @@ BT_GATT_SERVICE_DEFINE(
     BT_GATT_CHARACTERISTIC(
         BT_UUID_SWS_NC,             // Notification Characteristic UUID
         BT_GATT_CHRC_WRITE,         // Characteristic attribute properties, just write for notifications
-        BT_GATT_PERM_WRITE,         // Characteristic permissions, just write for notifications
+        BT_GATT_PERM_WRITE | BT_GATT_PERM_PREPARE_WRITE, // Just write, prepared chunks are shown to the callback
         NULL,                       // No read callbacks
         notification_write_callback,// Callback for receiving a write request
         NULL                        // No user_data for notification
@@ -17,6 +17,30 @@
 // SmartWatchService(SWS) Time Characteristic(TC) UUID
 #define BT_UUID_SWS_TC_VAL  BT_UUID_128_ENCODE(0x1f96e243, 0x7e6e, 0x452c, 0xab50, 0x3e0feb504976)
 
+/*
+    Notification Characteristic payload, one write per notification:
+        uint8_t version             SWS_NOTIFICATION_VERSION
+    followed by fields in any order, each one
+        uint8_t type                SWS_FIELD_*
+        uint16_t len                Big endian
+        uint8_t value[len]
+    Text fields are UTF-8 without a terminator, numbers are big endian of any length up to 8 bytes
+    (the same as the Time Characteristic). Unknown types are skipped so fields can be added without
+    bumping the version, a missing field is left empty.
+    A payload bigger than one write is sent as a long write, at most two prepared writes of the 247
+    byte MTU (CONFIG_BT_ATT_PREPARE_COUNT), so up to SWS_NOTIFICATION_MAX_SIZE bytes. The service
+    puts the chunks back together and passes the app the whole payload once.
+*/
+#define SWS_NOTIFICATION_VERSION    2
+#define SWS_NOTIFICATION_MAX_SIZE   480
+#define SWS_FIELD_HEADER_SIZE       3
+
+#define SWS_FIELD_APP               0x01
+#define SWS_FIELD_TITLE             0x02
+#define SWS_FIELD_BODY              0x03
+#define SWS_FIELD_TIMESTAMP         0x04    // Local time, seconds since the epoch
+#define SWS_FIELD_ID                0x05    // Phone's id for the notification, a repost with the same id replaces it
+
 // Declare the UUIDS from the more readable format above
 #define BT_UUID_SWS         BT_UUID_DECLARE_128(BT_UUID_SWS_VAL) 
 #define BT_UUID_SWS_NC      BT_UUID_DECLARE_128(BT_UUID_SWS_NC_VAL)
@@ -2,6 +2,7 @@
 #include <zephyr/drivers/gpio.h>
 
 #include "system.h"
+#include "trace.h"
 #include "bma400.h"
 #include "bma400_defs.h"
 #include "common.h"
@@ -46,6 +47,7 @@ static void bma400_INT1_callback(const struct device *dev, struct gpio_callback
     gpio_pin_interrupt_configure(gpio0_dev, BMA_INT1_PIN, GPIO_INT_DISABLE);
 
     // Signal taps thread to handle tap interrupt, can't do it inside interrupt context
+    traceMark(TRACE_TAP_IRQ);
     k_event_post(&tapsEvent, 0x01);
 
     int1Triggered = true;
@@ -252,6 +254,7 @@ static void singleTapCallback(struct k_timer* timer_id)
     // If this callback is ever triggered, then the timer expired without a double tap
     // This just means we got a real single tap
     printf("Single Tap\n");
+    traceMark(TRACE_TAP_SINGLE);
     k_event_post(&userInteractionEvent, SYSTEM_EVENT_SINGLE_TAP);
     k_timer_stop(&double_tap_timer);
 }
@@ -274,6 +277,7 @@ void tapsThread(void* p1, void* p2, void* p3)
             // A double tap will always follow a single tap so need to timeout before asserting the tap event
             //printf("BMA400 Interrupt: ");
             bma400_get_interrupt_status(&mInterruptStatus, &bma);
+            traceMark(TRACE_TAP_STATUS);
             
             // Handle triggered interrupts
             if (mInterruptStatus & BMA400_ASSERTED_S_TAP_INT)
@@ -288,6 +292,7 @@ void tapsThread(void* p1, void* p2, void* p3)
             {
                 // We got a double tap, we need to cancel the first single tap and register the double
                 k_timer_stop(&double_tap_timer);
+                traceMark(TRACE_TAP_DOUBLE); // Before posting, main preempts this thread
                 k_event_post(&userInteractionEvent, SYSTEM_EVENT_DOUBLE_TAP);
                 printf("Double tap\n");
             }
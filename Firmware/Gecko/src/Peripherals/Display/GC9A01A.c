@@ -4,6 +4,7 @@
 #include <nrfx.h>
 #include <nrfx_spim.h>
 #include "GC9A01A.h"
+#include "gc9a01_trace.h"
 #include "system.h"
 
 GC9A01A_device_t mGC9A01A_device = {
@@ -18,6 +19,20 @@ GC9A01A_device_t mGC9A01A_device = {
 static struct spi_buf_set   spi_tx_buffer_set;
 static struct spi_buf       tx_spi_buf;
 
+// Pixel stream, its transfer can still be in flight after GC9A01A_stream() returns so it gets its own buffer set
+#if defined(CONFIG_SPI_ASYNC) && defined(CONFIG_POLL)
+#define GC9A01A_STREAM_ASYNC 1
+#else
+#define GC9A01A_STREAM_ASYNC 0
+#endif
+
+static struct spi_buf_set   stream_buffer_set;
+static struct spi_buf       stream_spi_buf;
+#if GC9A01A_STREAM_ASYNC
+static struct k_poll_signal stream_signal;
+static bool                 stream_pending = false;
+#endif
+
 static GC9A01A_init_cmd_t GC9A01A_init_cmds[] = {
     {0xEF, {0}, 0, 0},
     {0xEB, {0x14}, 1, 0},
@@ -112,6 +127,7 @@ int GC9A01A_cmd(uint8_t cmd)
     spi_tx_buffer_set.count = 1;
 
     int error;
+    gc9a01_trace_cmd(cmd);
     error = gpio_pin_set(mGC9A01A_device.gpio_dev, mGC9A01A_device.data_cmd_pin, 0);
     error += spi_write(mGC9A01A_device.spi_dev, mGC9A01A_device.spi_cfg, &spi_tx_buffer_set);
     return error;
@@ -127,6 +143,7 @@ int GC9A01A_data(uint8_t* data, int len)
     spi_tx_buffer_set.count = 1;  
 
     int error;
+    gc9a01_trace_data(data, len, false);
     error = gpio_pin_set(mGC9A01A_device.gpio_dev, mGC9A01A_device.data_cmd_pin, 1);
     error += spi_write(mGC9A01A_device.spi_dev, mGC9A01A_device.spi_cfg, &spi_tx_buffer_set);
     return error;
@@ -135,6 +152,7 @@ int GC9A01A_data(uint8_t* data, int len)
 int GC9A01A_init(void)
 {
     int error;
+    gc9a01_trace_init(mGC9A01A_device.spi_cfg->frequency);
     error = gpio_pin_configure(mGC9A01A_device.gpio_dev, mGC9A01A_device.chip_select_pin, GPIO_OUTPUT);    
     error += gpio_pin_configure(mGC9A01A_device.gpio_dev, mGC9A01A_device.reset_pin, GPIO_OUTPUT);
     error += gpio_pin_configure(mGC9A01A_device.gpio_dev, mGC9A01A_device.data_cmd_pin, GPIO_OUTPUT);
@@ -232,6 +250,58 @@ void GC9A01A_write(uint8_t* data, int len)
     gpio_pin_set(mGC9A01A_device.gpio_dev, mGC9A01A_device.chip_select_pin, 1);
 }
 
+// Wait for the chunk last handed to GC9A01A_stream() to be off the wire
+static void GC9A01A_stream_wait(void)
+{
+#if GC9A01A_STREAM_ASYNC
+    struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &stream_signal);
+
+    if (!stream_pending) return;
+    k_poll(&event, 1, K_FOREVER);
+    k_poll_signal_reset(&stream_signal);
+    stream_pending = false;
+#endif
+}
+
+void GC9A01A_stream_begin(void)
+{
+#if GC9A01A_STREAM_ASYNC
+    k_poll_signal_init(&stream_signal);
+#endif
+    gpio_pin_set(mGC9A01A_device.gpio_dev, mGC9A01A_device.chip_select_pin, 0);
+    GC9A01A_cmd(0x2C);
+    gpio_pin_set(mGC9A01A_device.gpio_dev, mGC9A01A_device.data_cmd_pin, 1);
+}
+
+int GC9A01A_stream(const uint8_t* data, int len)
+{
+    int error;
+
+    gc9a01_trace_data(data, len, GC9A01A_STREAM_ASYNC);
+
+    // Previous chunk has to be out first, after that its buffer is the caller's again
+    GC9A01A_stream_wait();
+
+    stream_spi_buf.buf = (void*) data;
+    stream_spi_buf.len = len;
+    stream_buffer_set.buffers = &stream_spi_buf;
+    stream_buffer_set.count = 1;
+
+#if GC9A01A_STREAM_ASYNC
+    error = spi_write_signal(mGC9A01A_device.spi_dev, mGC9A01A_device.spi_cfg, &stream_buffer_set, &stream_signal);
+    stream_pending = (error == 0);
+#else
+    error = spi_write(mGC9A01A_device.spi_dev, mGC9A01A_device.spi_cfg, &stream_buffer_set);
+#endif
+    return error;
+}
+
+void GC9A01A_stream_end(void)
+{
+    GC9A01A_stream_wait();
+    gpio_pin_set(mGC9A01A_device.gpio_dev, mGC9A01A_device.chip_select_pin, 1);
+}
+
 void GC9A01A_sleep(void)
 {
     // Sleep command is 0x10
@@ -32,6 +32,17 @@ void GC9A01A_set_position(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint1
 
 void GC9A01A_write(uint8_t* data, int len);
 
+// Stream pixels into the window set by GC9A01A_set_position() in as many chunks as needed.
+// With CONFIG_SPI_ASYNC a chunk is sent while the caller fills the next one, so a chunk's buffer
+//  must be left alone until the following GC9A01A_stream() (or GC9A01A_stream_end()) returns.
+// Chunks can point straight into flash, the SPIM driver bounces them through its own RAM buffer
+//  (CONFIG_SPI_NRFX_RAM_BUFFER_SIZE) since EasyDMA only reads RAM.
+void GC9A01A_stream_begin(void);
+
+int GC9A01A_stream(const uint8_t* data, int len);
+
+void GC9A01A_stream_end(void);
+
 void GC9A01A_sleep(void);
 
 void GC9A01A_wake(void);
@@ -5,8 +5,6 @@
 #include <zephyr/drivers/pwm.h>
 #include "GC9A01A.h"
 
-#define SCREEN_BUFFER_SIZE 115200 // 240 * 240 * 2
-
 typedef enum {
     LCD_CHAR_EXTRA_SMALL = 1,
     LCD_CHAR_SMALL,
@@ -0,0 +1,340 @@
+#include <string.h>
+#include <lvgl.h>
+
+#include "asset_decoder.h"
+
+#define ASSET_HEADER_SIZE   4
+#define RLE_RUN_FLAG        0x80
+
+// Decoded rows of images streamed from a file (external flash), memory images decode too fast to bother
+#define LINE_CACHE_LINES    8
+#define LINE_CACHE_WIDTH    240 // Wider images are decoded straight into LVGL's buffer every time
+
+typedef struct {
+    const uint8_t* row_offsets;
+    const uint8_t* rows;
+    bool has_alpha;
+    uint16_t palette_size;
+    lv_color_t* colors;     // Palette converted to the display's color format once per open
+    lv_opa_t* alpha;        // Only with ASSET_FLAG_ALPHA
+    // File sources only
+    bool is_file;
+    lv_fs_file_t file;
+    uint32_t key;           // Hash of the path, identifies the image in the line cache
+    uint16_t width;
+    uint32_t file_row_offsets;
+    uint32_t file_rows;
+    uint32_t file_size;
+    uint8_t* row_buf;       // One row's packets, at most two bytes per pixel
+} Asset_Decoder_State;
+
+typedef struct {
+    uint32_t key;           // 0 while empty
+    lv_coord_t y;
+    uint32_t last_used;
+    uint8_t data[LINE_CACHE_WIDTH * LV_IMG_PX_SIZE_ALPHA_BYTE];
+} Asset_Line;
+
+static Asset_Line line_cache[LINE_CACHE_LINES];
+static uint32_t line_clock;
+static uint32_t line_hits;
+static uint32_t line_misses;
+
+static inline uint16_t get_le16(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8);
+}
+
+static inline uint32_t get_le32(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+// Only variable images marked as user encoded (with our format byte) are ours
+static const lv_img_dsc_t* asset_get(const void* src)
+{
+    const lv_img_dsc_t* img = src;
+
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return NULL;
+    if (img->header.cf != LV_IMG_CF_USER_ENCODED_0) return NULL;
+    if (img->data_size < ASSET_HEADER_SIZE || img->data[0] != ASSET_FORMAT_PALETTE_RLE) return NULL;
+    return img;
+}
+
+// Files are an lv_img_header_t followed by the same data, "*.rle" as packed by Resource Packer
+static bool asset_file_open(const void* src, lv_fs_file_t* file, lv_img_header_t* header, uint8_t* data_header)
+{
+    uint32_t read;
+
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE || strcmp(lv_fs_get_ext(src), "rle")) return false;
+    if (lv_fs_open(file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) return false;
+
+    if (lv_fs_read(file, header, sizeof(lv_img_header_t), &read) == LV_FS_RES_OK && read == sizeof(lv_img_header_t) &&
+        lv_fs_read(file, data_header, ASSET_HEADER_SIZE, &read) == LV_FS_RES_OK && read == ASSET_HEADER_SIZE &&
+        header->cf == LV_IMG_CF_USER_ENCODED_0 && data_header[0] == ASSET_FORMAT_PALETTE_RLE)
+    {
+        return true;
+    }
+
+    lv_fs_close(file);
+    return false;
+}
+
+static lv_res_t asset_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+    const lv_img_dsc_t* img = asset_get(src);
+    uint8_t flags;
+
+    if (img)
+    {
+        header->w = img->header.w;
+        header->h = img->header.h;
+        flags = img->data[1];
+    }
+    else
+    {
+        lv_fs_file_t file;
+        lv_img_header_t file_header;
+        uint8_t data_header[ASSET_HEADER_SIZE];
+
+        if (!asset_file_open(src, &file, &file_header, data_header)) return LV_RES_INV;
+        lv_fs_close(&file);
+        header->w = file_header.w;
+        header->h = file_header.h;
+        flags = data_header[1];
+    }
+
+    header->always_zero = 0;
+    // LVGL sees what comes out of read_line
+    header->cf = (flags & ASSET_FLAG_ALPHA) ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+static Asset_Decoder_State* asset_state_alloc(uint16_t palette_size, uint32_t extra)
+{
+    Asset_Decoder_State* state;
+    size_t size = sizeof(Asset_Decoder_State) + palette_size * (sizeof(lv_color_t) + sizeof(lv_opa_t)) + extra;
+
+    state = lv_mem_alloc(size);
+    if (!state) return NULL;
+
+    memset(state, 0, sizeof(Asset_Decoder_State));
+    state->palette_size = palette_size;
+    state->colors = (lv_color_t*)(state + 1);
+    state->alpha = (lv_opa_t*)(state->colors + palette_size);
+    return state;
+}
+
+static void asset_palette_set(Asset_Decoder_State* state, uint16_t index, const uint8_t* entry)
+{
+    state->colors[index] = lv_color_make(entry[2], entry[1], entry[0]);
+    state->alpha[index] = entry[3];
+}
+
+static lv_res_t asset_open_file(lv_img_decoder_dsc_t* dsc)
+{
+    Asset_Decoder_State* state;
+    lv_fs_file_t file;
+    lv_img_header_t header;
+    uint8_t data_header[ASSET_HEADER_SIZE];
+    uint16_t palette_size;
+    uint32_t data_start = sizeof(lv_img_header_t);
+    uint32_t read;
+
+    if (!asset_file_open(dsc->src, &file, &header, data_header)) return LV_RES_INV;
+
+    palette_size = get_le16(&data_header[2]);
+    state = asset_state_alloc(palette_size, header.w * 2);
+    if (!state)
+    {
+        lv_fs_close(&file);
+        return LV_RES_INV;
+    }
+
+    state->is_file = true;
+    state->file = file;
+    state->has_alpha = data_header[1] & ASSET_FLAG_ALPHA;
+    state->width = header.w;
+    state->row_buf = (uint8_t*)(state->alpha + palette_size);
+    state->file_row_offsets = data_start + ASSET_HEADER_SIZE + palette_size * 4;
+    state->file_rows = state->file_row_offsets + header.h * 4;
+    lv_fs_seek(&state->file, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&state->file, &state->file_size);
+
+    // FNV-1a
+    state->key = 2166136261u;
+    for (const char* c = dsc->src; *c; c++) state->key = (state->key ^ (uint8_t)*c) * 16777619u;
+    if (!state->key) state->key = 1;
+
+    lv_fs_seek(&state->file, data_start + ASSET_HEADER_SIZE, LV_FS_SEEK_SET);
+    for (uint16_t i = 0; i < palette_size; i++)
+    {
+        uint8_t entry[4];
+
+        if (lv_fs_read(&state->file, entry, sizeof(entry), &read) != LV_FS_RES_OK || read != sizeof(entry))
+        {
+            lv_fs_close(&state->file);
+            lv_mem_free(state);
+            return LV_RES_INV;
+        }
+        asset_palette_set(state, i, entry);
+    }
+
+    dsc->user_data = state;
+    dsc->img_data = NULL;
+    return LV_RES_OK;
+}
+
+static lv_res_t asset_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+    const lv_img_dsc_t* img = asset_get(dsc->src);
+    Asset_Decoder_State* state;
+    const uint8_t* palette;
+
+    if (!img) return asset_open_file(dsc);
+
+    palette = &img->data[ASSET_HEADER_SIZE];
+    state = asset_state_alloc(get_le16(&img->data[2]), 0);
+    if (!state) return LV_RES_INV;
+
+    state->has_alpha = img->data[1] & ASSET_FLAG_ALPHA;
+    state->row_offsets = palette + state->palette_size * 4;
+    state->rows = state->row_offsets + img->header.h * 4;
+
+    for (uint16_t i = 0; i < state->palette_size; i++)
+    {
+        asset_palette_set(state, i, &palette[i * 4]);
+    }
+
+    dsc->user_data = state;
+    dsc->img_data = NULL; // Makes LVGL ask for one line at a time
+    return LV_RES_OK;
+}
+
+// Decode len pixels starting at x of a row, runs before x are skipped without expanding them
+static lv_res_t asset_decode_row(const Asset_Decoder_State* state, const uint8_t* packet, lv_coord_t x, lv_coord_t len, uint8_t* buf)
+{
+    lv_coord_t pos = 0;
+    lv_coord_t end = x + len;
+
+    while (pos < end)
+    {
+        uint8_t header = *packet++;
+        bool run = header & RLE_RUN_FLAG;
+        lv_coord_t count = (header & ~RLE_RUN_FLAG) + 1;
+        lv_coord_t first = LV_MAX(pos, x);
+        lv_coord_t last = LV_MIN(pos + count, end);
+
+        for (lv_coord_t i = first; i < last; i++)
+        {
+            uint8_t index = run ? packet[0] : packet[i - pos];
+
+            if (index >= state->palette_size) return LV_RES_INV;
+            if (state->has_alpha)
+            {
+                memcpy(buf, &state->colors[index], sizeof(lv_color_t));
+                buf[sizeof(lv_color_t)] = state->alpha[index];
+                buf += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+            else
+            {
+                memcpy(buf, &state->colors[index], sizeof(lv_color_t));
+                buf += sizeof(lv_color_t);
+            }
+        }
+
+        packet += run ? 1 : count;
+        pos += count;
+    }
+
+    return LV_RES_OK;
+}
+
+// Pull row y's packets out of the file into row_buf
+static lv_res_t asset_file_row(Asset_Decoder_State* state, lv_coord_t y)
+{
+    uint8_t offsets[8];
+    uint32_t start, end, read;
+    uint32_t last_row = (state->file_rows - state->file_row_offsets) / 4 - 1;
+
+    lv_fs_seek(&state->file, state->file_row_offsets + y * 4, LV_FS_SEEK_SET);
+    if (lv_fs_read(&state->file, offsets, y < last_row ? 8 : 4, &read) != LV_FS_RES_OK) return LV_RES_INV;
+
+    start = state->file_rows + get_le32(offsets);
+    end = (y < last_row) ? state->file_rows + get_le32(&offsets[4]) : state->file_size;
+    if (end < start || end - start > state->width * 2u) return LV_RES_INV;
+
+    lv_fs_seek(&state->file, start, LV_FS_SEEK_SET);
+    if (lv_fs_read(&state->file, state->row_buf, end - start, &read) != LV_FS_RES_OK || read != end - start) return LV_RES_INV;
+    return LV_RES_OK;
+}
+
+static lv_res_t asset_read_line_file(Asset_Decoder_State* state, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf)
+{
+    uint8_t px_size = state->has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    Asset_Line* victim = &line_cache[0];
+
+    if (state->width > LINE_CACHE_WIDTH)
+    {
+        if (asset_file_row(state, y) != LV_RES_OK) return LV_RES_INV;
+        return asset_decode_row(state, state->row_buf, x, len, buf);
+    }
+
+    for (uint8_t i = 0; i < LINE_CACHE_LINES; i++)
+    {
+        Asset_Line* line = &line_cache[i];
+
+        if (line->key == state->key && line->y == y)
+        {
+            line_hits++;
+            line->last_used = ++line_clock;
+            memcpy(buf, &line->data[x * px_size], len * px_size);
+            return LV_RES_OK;
+        }
+        if (line->last_used < victim->last_used) victim = line;
+    }
+
+    // Decode the whole row so later reads of other parts of it hit too
+    line_misses++;
+    victim->key = 0;
+    if (asset_file_row(state, y) != LV_RES_OK) return LV_RES_INV;
+    if (asset_decode_row(state, state->row_buf, 0, state->width, victim->data) != LV_RES_OK) return LV_RES_INV;
+    victim->key = state->key;
+    victim->y = y;
+    victim->last_used = ++line_clock;
+    memcpy(buf, &victim->data[x * px_size], len * px_size);
+    return LV_RES_OK;
+}
+
+static lv_res_t asset_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf)
+{
+    Asset_Decoder_State* state = dsc->user_data;
+
+    if (state->is_file) return asset_read_line_file(state, x, y, len, buf);
+    return asset_decode_row(state, state->rows + get_le32(&state->row_offsets[y * 4]), x, len, buf);
+}
+
+static void asset_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+    Asset_Decoder_State* state = dsc->user_data;
+
+    if (state->is_file) lv_fs_close(&state->file);
+    lv_mem_free(dsc->user_data);
+    dsc->user_data = NULL;
+}
+
+void asset_decoder_init(void)
+{
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+
+    lv_img_decoder_set_info_cb(decoder, asset_info);
+    lv_img_decoder_set_open_cb(decoder, asset_open);
+    lv_img_decoder_set_read_line_cb(decoder, asset_read_line);
+    lv_img_decoder_set_close_cb(decoder, asset_close);
+}
+
+void asset_decoder_get_line_stats(uint32_t* hits, uint32_t* misses)
+{
+    *hits = line_hits;
+    *misses = line_misses;
+}
@@ -0,0 +1,30 @@
+#ifndef __ASSET_DECODER__
+#define __ASSET_DECODER__
+
+#include <lvgl.h>
+
+/*
+    Decoder for images built by Software Tools/Asset Compiler with the "rle" format, registered
+    with LVGL so they are used like any other lv_img_dsc_t (cf = LV_IMG_CF_USER_ENCODED_0).
+    Rows are decompressed one at a time straight into the draw buffer, the image itself is never
+    unpacked in RAM. The same data behind an lv_img_header_t also works as a "*.rle" file, which is
+    how images on the external flash are stored (see flash_resources.h), their decoded rows are
+    kept in a small LRU cache since every row costs a flash read.
+
+    Data layout, little endian:
+        uint8_t  format             ASSET_FORMAT_PALETTE_RLE
+        uint8_t  flags              ASSET_FLAG_ALPHA if any palette entry is see through
+        uint16_t palette_size       1 - 256
+        uint32_t palette[]          B, G, R, A bytes per entry (lv_color32_t)
+        uint32_t row_offsets[h]     Start of each row in the row data
+        uint8_t  rows[]             Packets of palette indices: 0x80 | (n - 1) then one index
+                                    repeats it n times, n - 1 (< 0x80) then n indices copies them
+*/
+
+#define ASSET_FORMAT_PALETTE_RLE    1
+#define ASSET_FLAG_ALPHA            0x01
+
+void asset_decoder_init(void);
+void asset_decoder_get_line_stats(uint32_t* hits, uint32_t* misses);
+
+#endif // __ASSET_DECODER__
@@ -1839,111 +1839,181 @@
   Start of lvgl assets
 */
 
+// Home screen sloth, run length encoded (drawn through asset_decoder.c)
+// Generated by asset_compiler.py from assets/sloth.png, rle (4022 bytes, 20000 as RGB565)
 const uint8_t img_sloth_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x59, 0xce, 0x72, 0x94, 0xcb, 0x5a, 0x86, 0x31, 0x04, 0x21, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0x04, 0x21, 0xa6, 0x31, 0xec, 0x62, 0xb2, 0x94, 0x7a, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x8e, 0x73, 0xa2, 0x10, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x20, 0xe8, 0x41, 0x8a, 0x52, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xab, 0x5a, 0x62, 0x10, 0x04, 0x21, 0xcb, 0x5a, 0x29, 0x4a, 0x21, 0x08, 0xe8, 0x41, 0xcb, 0x5a, 0xe8, 0x41, 0x21, 0x08, 0x69, 0x4a, 0x49, 0x4a, 0xc7, 0x39, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0x8a, 0x52, 0xe8, 0x41, 0xc3, 0x18, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x18, 0xf0, 0x83, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x0c, 0x63, 0x21, 0x08, 0x62, 0x10, 0x8a, 0x52, 0x35, 0xad, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xc7, 0x39, 0x8e, 0x73, 0x7d, 0xef, 0xb2, 0x94, 0x86, 0x31, 0x55, 0xad, 0xff, 0xff, 0x14, 0xa5, 0xa7, 0x39, 0x18, 0xc6, 0xdb, 0xde, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x14, 0xa5, 0x29, 0x4a, 0x41, 0x08, 0x41, 0x08, 0x6e, 0x73, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0x82, 0x10, 0x21, 0x08, 0x8e, 0x73, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0xc7, 0x39, 0x7a, 0xd6, 0xba, 0xd6, 0x49, 0x4a, 0x72, 0x94, 0xbf, 0xff, 0xff, 0xff, 0x8e, 0x73, 0xcf, 0x7b, 0xbf, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x4d, 0x6b, 0x41, 0x08, 0xa2, 0x10, 0x35, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xcb, 0x5a, 0x00, 0x00, 0x08, 0x42, 0x7a, 0xd6, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x2d, 0x6b, 0x71, 0x8c, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xc7, 0x39, 0x20, 0x00, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x28, 0x42, 0x21, 0x08, 0xaf, 0x7b, 0xcb, 0x5a, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x7b, 0x20, 0x00, 0x8a, 0x52, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x49, 0x4a, 0x00, 0x00, 0xaa, 0x52, 0xbf, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0x21, 0x08, 0xaa, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x6b, 0x20, 0x00, 0xb3, 0x9c, 0x51, 0x8c, 0x49, 0x4a, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0xcf, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xad, 0x00, 0x00, 0xaf, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x96, 0xb5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x6b, 0x21, 0x08, 0xf8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xc3, 0x18, 0xa7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x65, 0x29, 0x45, 0x29, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0x41, 0x08, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xbb, 0xde, 0x18, 0xc6, 0x76, 0xb5, 0x35, 0xad, 0x34, 0xa5, 0x75, 0xad, 0x59, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x20, 0x00, 0x71, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x82, 0x10, 0xaa, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdb, 0xde, 0x75, 0xad, 0x71, 0x8c, 0x51, 0x8c, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xf4, 0xa4, 0x51, 0x8c, 0x51, 0x8c, 0x55, 0xad, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0x10, 0x84, 0xa6, 0x31, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0xaa, 0x52, 0x76, 0xb5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x08, 0x42, 0xc3, 0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0x21, 0x08, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x7a, 0xd6, 0xff, 0xff, 0x1c, 0xe7, 0xd3, 0x9c, 0x28, 0x42, 0xc3, 0x18, 0x8a, 0x52, 0xb6, 0xb5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xcb, 0x5a, 0x49, 0x4a, 0xef, 0x7b, 0x55, 0xad, 0x9a, 0xd6, 0x5d, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x96, 0xb5, 0xcb, 0x5a, 0x82, 0x10, 0xa2, 0x10, 0x8e, 0x73, 0xfc, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x2c, 0x63, 0x9a, 0xd6, 0xff, 0xff, 0xf7, 0xbd, 0x00, 0x00, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc7, 0x39, 0x65, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xd3, 0x9c, 0x92, 0x94, 0x96, 0xb5, 0x49, 0x4a, 0x41, 0x08, 0xe4, 0x20, 0x10, 0x84, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x72, 0x94, 0x24, 0x21, 0x41, 0x08, 0xeb, 0x5a, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xa6, 0x31, 0xfc, 0xe6, 0xff, 0xff, 0xc3, 0x18, 0x69, 0x4a, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x5d, 0xef, 0x21, 0x08, 0xef, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xe7, 0x39, 0x30, 0x84, 0x86, 0x31, 0x20, 0x00, 0x86, 0x31, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x65, 0x29, 0x21, 0x08, 0x4d, 0x6b, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xa7, 0x39, 0xdf, 0xff, 0x8e, 0x73, 0xa2, 0x10, 0xbf, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf7, 0xbd, 0x00, 0x00, 0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x49, 0x4a, 0xc7, 0x39, 0xa7, 0x39, 0x20, 0x00, 0xe7, 0x39, 0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xad, 0xe4, 0x20, 0x61, 0x08, 0xef, 0x7b, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x8e, 0x73, 0x96, 0xb5, 0x00, 0x00, 0xba, 0xd6, 0xff, 0xff,
-  0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x82, 0x10, 0x41, 0x08, 0x20, 0x00, 0x25, 0x29, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x4d, 0x6b, 0x20, 0x00, 0xc3, 0x18, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x24, 0x21, 0x76, 0xb5, 0x00, 0x00, 0x14, 0xa5, 0xff, 0xff,
-  0xff, 0xff, 0x6e, 0x73, 0x82, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x20, 0x00, 0x00, 0x00, 0x82, 0x10, 0x72, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0xa2, 0x10, 0x00, 0x00, 0x4d, 0x6b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xc7, 0x39, 0x41, 0x08, 0xef, 0x7b, 0xff, 0xff,
-  0xff, 0xff, 0xcb, 0x5a, 0x04, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xec, 0x62, 0x00, 0x00, 0x20, 0x00, 0xaa, 0x52, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x08, 0x42, 0x00, 0x00, 0x29, 0x4a, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xbe, 0xf7, 0xa6, 0x31, 0x21, 0x08, 0x4d, 0x6b, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x49, 0x4a, 0x00, 0x00, 0xa2, 0x10, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0x62, 0x10, 0xa6, 0x31, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x8e, 0x73, 0xd7, 0xbd, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0x00, 0x00, 0x86, 0x31, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x86, 0x31, 0xa7, 0x39, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xad, 0xef, 0x7b, 0xa3, 0x18, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0xab, 0x5a, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x10, 0x84, 0x49, 0x4a, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0x42, 0x62, 0x10, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0x20, 0x00, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xad, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xce, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x21, 0x08, 0xef, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xff, 0xff, 0xc3, 0x18, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xc3, 0x18, 0x51, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb6, 0xb5, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x28, 0x42, 0x75, 0xad, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x4d, 0x6b, 0x66, 0x31, 0xe8, 0x41, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xa2, 0x10, 0x62, 0x10, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xb7, 0xbd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xa5, 0xd3, 0x9c, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x72, 0x94, 0x29, 0x4a, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x04, 0x21, 0x86, 0x31, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x62, 0x10, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x18, 0xc6, 0x34, 0xa5, 0x72, 0x94, 0xcf, 0x7b, 0x6d, 0x6b, 0x2d, 0x6b, 0x8e, 0x73, 0x51, 0x8c, 0x55, 0xad, 0x9a, 0xd6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x10, 0x84, 0x82, 0x10, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0x08, 0x42, 0x0c, 0x63, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x76, 0xb5, 0x6e, 0x73, 0xa7, 0x39, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x08, 0x42, 0x72, 0x94, 0x7a, 0xd6, 0x55, 0xad, 0x18, 0xc6, 0x0c, 0x63, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xdb, 0xde, 0xe7, 0x39, 0x66, 0x31, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x1c, 0xe7, 0xb7, 0xbd, 0x31, 0x8c, 0x2d, 0x6b, 0x6a, 0x52, 0xc7, 0x39, 0x45, 0x29, 0xc3, 0x18, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0xa2, 0x10, 0x45, 0x29, 0xcb, 0x5a, 0x34, 0xa5, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0x0c, 0x63, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x41, 0x08, 0x82, 0x10, 0x82, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xef, 0x7b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xa7, 0x39, 0xd3, 0x9c, 0xdb, 0xde, 0x4d, 0x6b, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x55, 0xad, 0x6d, 0x6b, 0xa6, 0x31, 0xa2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0xe4, 0x20, 0x24, 0x21, 0x24, 0x21, 0x65, 0x29, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x45, 0x29, 0xe4, 0x20, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x18, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xaa, 0x52, 0x20, 0x00, 0x00, 0x00, 0xa3, 0x18, 0xec, 0x62, 0xd3, 0x9c, 0x18, 0xc6, 0xfc, 0xe6, 0x5d, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5d, 0xef, 0xdb, 0xde, 0x96, 0xb5, 0xcf, 0x7b, 0xe7, 0x39, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x39, 0xb6, 0xb5, 0xdf, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xdf, 0xff, 0x92, 0x94, 0x28, 0x42, 0x3c, 0xe7, 0x7e, 0xf7, 0xb2, 0x94, 0x86, 0x31, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x2d, 0x6b, 0x34, 0xa5, 0xfb, 0xde, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x59, 0xce, 0xaf, 0x7b, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x52, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x94, 0x41, 0x08, 0x00, 0x00, 0xe3, 0x18, 0x92, 0x94, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x75, 0xad, 0x69, 0x4a, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x29, 0x62, 0x10, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0xe3, 0x18, 0x28, 0x42, 0xef, 0x7b, 0xbb, 0xde, 0x6d, 0x6b, 0x61, 0x08, 0x00, 0x00, 0x20, 0x00, 0x45, 0x29, 0x10, 0x84, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xa3, 0x18, 0x00, 0x00, 0x08, 0x42, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x49, 0x4a, 0x00, 0x00, 0x61, 0x08, 0xf0, 0x83, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xf7, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xef, 0x7b, 0xc3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x41, 0x08, 0x92, 0x94, 0x49, 0x4a, 0x20, 0x00, 0x00, 0x00, 0x41, 0x08, 0x6a, 0x52, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x31, 0x8c, 0x31, 0x8c, 0x71, 0x8c, 0x34, 0xa5, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x21, 0x08, 0x00, 0x00, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0x00, 0x00, 0x28, 0x42, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xa6, 0x31, 0xa2, 0x10, 0x20, 0x00, 0x41, 0x08, 0xab, 0x5a, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xb3, 0x9c, 0xe4, 0x20, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x08, 0xec, 0x62, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x4d, 0x6b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x52, 0x00, 0x00, 0x86, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x41, 0x08, 0xcb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xa3, 0x18, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x00, 0x00, 0x21, 0x08, 0xaa, 0x52, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x84, 0x00, 0x00, 0xc3, 0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x00, 0x00, 0x35, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x62, 0x10, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x00, 0x00, 0xc3, 0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x6b, 0x00, 0x00, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x00, 0x00, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x39, 0x00, 0x00, 0x49, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x00, 0x00, 0x35, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x61, 0x08, 0x00, 0x00, 0x10, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x00, 0x00, 0xcf, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x00, 0x00, 0xa6, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0x00, 0x00, 0x61, 0x08, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0x29, 0x41, 0x08, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x21, 0x08, 0x00, 0x00, 0x49, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7d, 0xef, 0x3d, 0xef, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x0c, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0c, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x14, 0xa5, 0x29, 0x4a, 0xe4, 0x20, 0x04, 0x21, 0x45, 0x29, 0x65, 0x29, 0xe7, 0x39, 0xe8, 0x41, 0xc7, 0x39, 0xa6, 0x31, 0x08, 0x42, 0x0c, 0x63, 0x92, 0x94, 0x59, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xc3, 0x18, 0x20, 0x00, 0x76, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0xc3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x4d, 0x6b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x21, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x86, 0x31, 0xaf, 0x7b, 0x59, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x7e, 0xf7, 0xfb, 0xde, 0x18, 0xc6, 0xb3, 0x9c, 0xcb, 0x5a, 0x4d, 0x6b, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x00, 0x00, 0x62, 0x10, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x96, 0xb5, 0xaf, 0x7b, 0xcb, 0x5a, 0xec, 0x62, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x18, 0xc6, 0x18, 0xc6, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x20, 0x00, 0x00, 0x00, 0x41, 0x08, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x73, 0xa6, 0x31, 0x79, 0xce, 0xb2, 0x94, 0x6e, 0x73, 0x69, 0x4a, 0x86, 0x31, 0x04, 0x21, 0x24, 0x21, 0x66, 0x31, 0xc7, 0x39, 0x08, 0x42, 0x49, 0x4a, 0x69, 0x4a, 0xeb, 0x5a, 0xcf, 0x7b, 0x35, 0xad, 0x3d, 0xef, 0xfb, 0xde, 0x6d, 0x6b, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0x00, 0x00, 0x82, 0x10, 0x76, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0x00, 0x00, 0x20, 0x00, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0xe8, 0x41, 0x96, 0xb5, 0xe4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x75, 0xad, 0xc7, 0x39, 0x61, 0x08, 0x6d, 0x6b, 0xff, 0xff, 0x8e, 0x73, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0x21, 0x08, 0x20, 0x00, 0xaa, 0x52, 0xbb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xaa, 0x52, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0x86, 0x31, 0x9a, 0xd6, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x10, 0x10, 0x84, 0x55, 0xad, 0xd7, 0xbd, 0x59, 0xce, 0x7d, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0x00, 0x00, 0x96, 0xb5, 0xbe, 0xf7, 0x66, 0x31, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x86, 0x31, 0x00, 0x00, 0x20, 0x00, 0xe8, 0x41, 0x71, 0x8c, 0x59, 0xce, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xe7, 0x55, 0xad, 0x49, 0x4a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x39, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xa2, 0x10, 0x38, 0xc6, 0x6d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x6d, 0x6b, 0x9a, 0xd6, 0xeb, 0x5a, 0xcf, 0x7b, 0x38, 0xc6, 0xbb, 0xde, 0x21, 0x08, 0x8a, 0x52, 0xff, 0xff, 0x75, 0xad, 0xab, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x69, 0x4a, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x18, 0x04, 0x21, 0x25, 0x29, 0x25, 0x29, 0x04, 0x21, 0xe3, 0x18, 0xa2, 0x10, 0x62, 0x10, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0xc3, 0x18, 0xc7, 0x39, 0x0c, 0x63, 0xd3, 0x9c, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x9a, 0xd6, 0x18, 0xc6, 0x96, 0xb5, 0x14, 0xa5, 0x72, 0x94, 0x10, 0x84, 0xcf, 0x7b, 0x6d, 0x6b, 0xcb, 0x5a, 0xa7, 0x39, 0xc3, 0x18, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x86, 0x31, 0x14, 0xa5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x84, 0xa3, 0x18, 0xbf, 0xff, 0xa2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x00, 0x00, 0xe3, 0x18, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x31, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xd7, 0xbd, 0x10, 0x84, 0xec, 0x62, 0x49, 0x4a, 0xc7, 0x39, 0x86, 0x31, 0x66, 0x31, 0x45, 0x29, 0x24, 0x21, 0xe3, 0x18, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x45, 0x29, 0x72, 0x94, 0xc3, 0x18, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb6, 0xb5, 0x8e, 0x73, 0x86, 0x31, 0x61, 0x08, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x65, 0x29, 0xef, 0x7b, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x6a, 0x52, 0xff, 0xff, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0xdf, 0xff, 0xff, 0xff, 0x55, 0xad, 0xaa, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7e, 0xf7, 0x18, 0xc6, 0x31, 0x8c, 0x08, 0x42, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xdf, 0xff, 0xd7, 0xbd, 0xcb, 0x5a, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x82, 0x10, 0x86, 0x31, 0xeb, 0x5a, 0xf0, 0x83, 0xd3, 0x9c, 0x55, 0xad, 0x96, 0xb5, 0xd7, 0xbd, 0x79, 0xce, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0x21, 0x08, 0x18, 0xc6, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x65, 0x29, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xf3, 0x9c, 0xa6, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x82, 0x10, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x28, 0x42, 0x51, 0x8c, 0x9a, 0xd6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x41, 0x08, 0x30, 0x84, 0xff, 0xff, 0xff, 0xff, 0x69, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xa5, 0x49, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xe8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x28, 0x42, 0x34, 0xa5, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xe3, 0x18, 0xcb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x31, 0xf4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x18, 0xcf, 0x7b, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x86, 0x31, 0xc7, 0x39, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xa2, 0x10, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x4d, 0x6b, 0x00, 0x00, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x00, 0x00, 0x21, 0x08, 0x2d, 0x6b, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xa6, 0x31, 0x25, 0x29, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xcf, 0x7b, 0x6a, 0x52, 0x86, 0x31, 0x25, 0x29, 0x04, 0x21, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe4, 0x20, 0x04, 0x21, 0x65, 0x29, 0x49, 0x4a, 0x4d, 0x6b, 0x92, 0x94, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xc3, 0x18, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x18, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x61, 0x08, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x55, 0xad, 0x6e, 0x73, 0x45, 0x29, 0x61, 0x08, 0x2c, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x45, 0x29, 0x24, 0x21, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0xa2, 0x10, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xa3, 0x18, 0x61, 0x08, 0xab, 0x5a, 0x76, 0xb5, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xfb, 0xde, 0xfc, 0xe6, 0x7a, 0xd6, 0x30, 0x84, 0x62, 0x10, 0x08, 0x42, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0x82, 0x10, 0x72, 0x94, 0xdf, 0xff, 0xbf, 0xff, 0x34, 0xa5, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x18, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0x0c, 0x63, 0x14, 0xa5, 0x8a, 0x52, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xe4, 0x20, 0x25, 0x29, 0xc3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0xb2, 0x94, 0x92, 0x94, 0x0c, 0x63, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xef, 0x7b, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x18, 0x6e, 0x73, 0xd7, 0xbd, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x7e, 0xf7, 0x3d, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xf7, 0xbd, 0x8e, 0x73, 0xe3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x76, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x52, 0x8e, 0x73, 0xa7, 0x39, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x86, 0x31, 0x4d, 0x6b, 0x71, 0x8c, 0x14, 0xa5, 0x76, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x55, 0xad, 0x92, 0x94, 0xcf, 0x7b, 0x0c, 0x63, 0x49, 0x4a, 0x66, 0x31, 0xc3, 0x18, 0x04, 0x21, 0x49, 0x4a, 0xc7, 0x39, 0xa2, 0x10, 0x41, 0x08, 0x20, 0x00, 0xe3, 0x18, 0x08, 0x42, 0x8e, 0x73, 0x92, 0x94, 0xd3, 0x9c, 0xf4, 0xa4, 0xf4, 0xa4, 0xd3, 0x9c, 0x51, 0x8c, 0x0c, 0x63, 0x66, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x08, 0x42, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0xe7, 0x39, 0xb7, 0xbd, 0x9e, 0xf7, 0xf8, 0xc5, 0xcf, 0x7b, 0xc7, 0x39, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x66, 0x31, 0x8e, 0x73, 0x18, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0x75, 0xad, 0x2c, 0x63, 0x45, 0x29, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xe3, 0x18, 0xa6, 0x31, 0x0c, 0x63, 0xf4, 0xa4, 0x3c, 0xe7, 0x5d, 0xef, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xce, 0xeb, 0x5a, 0xae, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x39, 0xce, 0x10, 0x84, 0xef, 0x7b, 0x31, 0x8c, 0x92, 0x94, 0x14, 0xa5, 0x75, 0xad, 0x96, 0xb5, 0xd7, 0xbd, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x38, 0xc6, 0x55, 0xad, 0xd3, 0x9c, 0xd3, 0x9c, 0x35, 0xad, 0x18, 0xc6, 0x1c, 0xe7, 0x9e, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf4, 0xa4, 0x31, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0xcb, 0x5a, 0xaa, 0x52, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xd3, 0x9c, 0x45, 0x29, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x65, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xde, 0x45, 0x29, 0x28, 0x42, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x38, 0xc6, 0x4d, 0x6b, 0x04, 0x21, 0x0c, 0x63, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xbf, 0xff, 0xf3, 0x9c, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x2d, 0x6b, 0x04, 0x21, 0x08, 0x42, 0x72, 0x94, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0xe8, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xbb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x61, 0x08, 0x79, 0xce, 0x69, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x45, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x92, 0x94, 0x66, 0x31, 0x5d, 0xef, 0xeb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x72, 0x94, 0x41, 0x08, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x59, 0xce, 0xbb, 0xde, 0x18, 0xc6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xc7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x41, 0x10, 0x84, 0xae, 0x73, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xf8, 0xc5, 0x61, 0x08, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x69, 0x4a, 0x9e, 0xf7, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x6b, 0xd7, 0xbd, 0x28, 0x42, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0x4a, 0x1c, 0xe7, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xab, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x61, 0x08, 0x59, 0xce, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x39, 0x7d, 0xef, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xaa, 0x52, 0x25, 0x29, 0xbe, 0xf7, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x5d, 0xef, 0x39, 0xce, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x20, 0x2c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0xcb, 0x5a, 0x04, 0x21, 0xf8, 0xc5, 0xeb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x94, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x18, 0x4d, 0x6b, 0xff, 0xff,
-  0xff, 0xff, 0x8e, 0x73, 0x62, 0x10, 0xaf, 0x7b, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0x24, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x08, 0xef, 0x7b, 0xff, 0xff,
-  0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0xc7, 0x39, 0x5d, 0xef, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xd3, 0x9c, 0xa3, 0x18, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x00, 0x00, 0x14, 0xa5, 0xff, 0xff,
-  0xff, 0xff, 0x18, 0xc6, 0x00, 0x00, 0x24, 0x21, 0xbf, 0xff, 0xa3, 0x18, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x04, 0x21, 0x1c, 0xe7, 0xf0, 0x83, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x00, 0x00, 0xbb, 0xde, 0xff, 0xff,
-  0xff, 0xff, 0x5d, 0xef, 0x41, 0x08, 0x86, 0x31, 0xfb, 0xde, 0x21, 0x08, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x61, 0x08, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0xa2, 0x10, 0xbf, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe8, 0x41, 0x04, 0x21, 0xba, 0xd6, 0x66, 0x31, 0x3c, 0xe7, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe4, 0x20, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc3, 0x18, 0x6a, 0x52, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0x20, 0x00, 0xb6, 0xb5, 0x6e, 0x73, 0x59, 0xce, 0x69, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x00, 0x00, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xa2, 0x10, 0x6a, 0x52, 0xdb, 0xde, 0x7a, 0xd6, 0xe7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x41, 0xc3, 0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0x21, 0x08, 0x59, 0xce, 0x1c, 0xe7, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0x20, 0x00, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xe4, 0x20, 0x66, 0x31, 0xbf, 0xff, 0xbb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x45, 0x29, 0x45, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x20, 0x00, 0x6e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x63, 0x41, 0x08, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0x20, 0x00, 0xb3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x00, 0x00, 0xf0, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0x21, 0x08, 0xd3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x20, 0x00, 0xcb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x49, 0x4a, 0x00, 0x00, 0xef, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xae, 0x73, 0x00, 0x00, 0x8a, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x2d, 0x6b, 0x20, 0x00, 0x08, 0x42, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xc7, 0x39, 0x20, 0x00, 0x6e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xad, 0xa3, 0x18, 0x41, 0x08, 0x4d, 0x6b, 0xfc, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x25, 0x29, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x2c, 0x63, 0x41, 0x08, 0xc3, 0x18, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x2c, 0x63, 0x41, 0x08, 0x21, 0x08, 0x69, 0x4a, 0x14, 0xa5, 0x96, 0xb5, 0x9e, 0xf7, 0x61, 0x08, 0x38, 0xc6, 0x51, 0x8c, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x14, 0xa5, 0x29, 0x4a, 0x20, 0x00, 0x41, 0x08, 0x6e, 0x73, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xcf, 0x7b, 0x04, 0x21, 0x20, 0x00, 0x00, 0x00, 0xc3, 0x18, 0x61, 0x08, 0x65, 0x29, 0x62, 0x10, 0x08, 0x42, 0x49, 0x4a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0x8a, 0x52, 0xc7, 0x39, 0xc3, 0x18, 0x00, 0x00, 0x21, 0x08, 0x25, 0x29, 0xef, 0x7b, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xb2, 0x94, 0x0c, 0x63, 0x08, 0x42, 0x86, 0x31, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x86, 0x31, 0x08, 0x42, 0x2c, 0x63, 0xd3, 0x9c, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x5f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xce, 0xca, 0xce, 0xff, 0x94, 0x8e, 0x94, 0xff, 0x5a, 0x59, 0x5a, 0xff,
+  0x31, 0x31, 0x31, 0xff, 0x21, 0x20, 0x21, 0xff, 0x21, 0x1c, 0x21, 0xff, 0x31, 0x35, 0x31, 0xff, 0x63, 0x5d, 0x63, 0xff, 0x94, 0x96, 0x94, 0xff,
+  0xd6, 0xce, 0xd6, 0xff, 0xe6, 0xe3, 0xe6, 0xff, 0x73, 0x71, 0x73, 0xff, 0x10, 0x14, 0x10, 0xff, 0x00, 0x00, 0x00, 0xff, 0x42, 0x3d, 0x42, 0xff,
+  0x52, 0x51, 0x52, 0xff, 0x5a, 0x55, 0x5a, 0xff, 0x10, 0x0c, 0x10, 0xff, 0x4a, 0x45, 0x4a, 0xff, 0x08, 0x04, 0x08, 0xff, 0x4a, 0x4d, 0x4a, 0xff,
+  0x4a, 0x49, 0x4a, 0xff, 0x3a, 0x39, 0x3a, 0xff, 0x19, 0x18, 0x19, 0xff, 0x19, 0x1c, 0x19, 0xff, 0x84, 0x7d, 0x84, 0xff, 0xef, 0xe7, 0xef, 0xff,
+  0xe6, 0xe7, 0xe6, 0xff, 0x63, 0x61, 0x63, 0xff, 0xad, 0xa6, 0xad, 0xff, 0xef, 0xeb, 0xef, 0xff, 0xef, 0xef, 0xef, 0xff, 0xad, 0xaa, 0xad, 0xff,
+  0xa5, 0xa2, 0xa5, 0xff, 0x3a, 0x35, 0x3a, 0xff, 0xc5, 0xc2, 0xc5, 0xff, 0xde, 0xdb, 0xde, 0xff, 0x9c, 0x9a, 0x9c, 0xff, 0x08, 0x08, 0x08, 0xff,
+  0x73, 0x6d, 0x73, 0xff, 0x10, 0x10, 0x10, 0xff, 0x8c, 0x8a, 0x8c, 0xff, 0xd6, 0xd7, 0xd6, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x7b, 0x79, 0x7b, 0xff,
+  0xf7, 0xf3, 0xf7, 0xff, 0x6b, 0x69, 0x6b, 0xff, 0x42, 0x41, 0x42, 0xff, 0xbd, 0xb6, 0xbd, 0xff, 0x6b, 0x65, 0x6b, 0xff, 0x8c, 0x8e, 0x8c, 0xff,
+  0x00, 0x04, 0x00, 0xff, 0x42, 0x45, 0x42, 0xff, 0x7b, 0x75, 0x7b, 0xff, 0x52, 0x55, 0x52, 0xff, 0x9c, 0x9e, 0x9c, 0xff, 0x9c, 0x96, 0x9c, 0xff,
+  0xc5, 0xc6, 0xc5, 0xff, 0x94, 0x92, 0x94, 0xff, 0xad, 0xae, 0xad, 0xff, 0xbd, 0xba, 0xbd, 0xff, 0xb5, 0xb2, 0xb5, 0xff, 0xc5, 0xbe, 0xc5, 0xff,
+  0xf7, 0xef, 0xf7, 0xff, 0x29, 0x2d, 0x29, 0xff, 0x29, 0x28, 0x29, 0xff, 0xd6, 0xd2, 0xd6, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xde, 0xd7, 0xde, 0xff,
+  0xb5, 0xae, 0xb5, 0xff, 0xa5, 0xa6, 0xa5, 0xff, 0xbd, 0xbe, 0xbd, 0xff, 0xa5, 0x9e, 0xa5, 0xff, 0x84, 0x82, 0x84, 0xff, 0x08, 0x0c, 0x08, 0xff,
+  0xb5, 0xb6, 0xb5, 0xff, 0x7b, 0x7d, 0x7b, 0xff, 0xe6, 0xdf, 0xe6, 0xff, 0x63, 0x65, 0x63, 0xff, 0x21, 0x24, 0x21, 0xff, 0x5a, 0x5d, 0x5a, 0xff,
+  0x3a, 0x3d, 0x3a, 0xff, 0x84, 0x86, 0x84, 0xff, 0x29, 0x24, 0x29, 0xff, 0x19, 0x14, 0x19, 0xff, 0xce, 0xc6, 0xce, 0xff, 0x31, 0x2d, 0x31, 0xff,
+  0xde, 0xdf, 0xde, 0xff, 0x6b, 0x6d, 0x6b, 0xff, 0x8c, 0x86, 0x8c, 0xff, 0x52, 0x4d, 0x52, 0xff, 0xce, 0xce, 0xce, 0xff, 0x73, 0x75, 0x73, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00,
+  0x14, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00,
+  0xb3, 0x02, 0x00, 0x00, 0xc5, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00,
+  0x49, 0x03, 0x00, 0x00, 0x6b, 0x03, 0x00, 0x00, 0xa5, 0x03, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00,
+  0x82, 0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0xdd, 0x04, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x2e, 0x05, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00,
+  0x7b, 0x05, 0x00, 0x00, 0xa2, 0x05, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00, 0x36, 0x06, 0x00, 0x00, 0x76, 0x06, 0x00, 0x00,
+  0xae, 0x06, 0x00, 0x00, 0xdf, 0x06, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x5d, 0x07, 0x00, 0x00, 0xa5, 0x07, 0x00, 0x00, 0xd6, 0x07, 0x00, 0x00,
+  0x09, 0x08, 0x00, 0x00, 0x32, 0x08, 0x00, 0x00, 0x59, 0x08, 0x00, 0x00, 0x81, 0x08, 0x00, 0x00, 0xb8, 0x08, 0x00, 0x00, 0xe6, 0x08, 0x00, 0x00,
+  0x0e, 0x09, 0x00, 0x00, 0x33, 0x09, 0x00, 0x00, 0x5c, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0xc6, 0x09, 0x00, 0x00, 0xf6, 0x09, 0x00, 0x00,
+  0x11, 0x0a, 0x00, 0x00, 0x2e, 0x0a, 0x00, 0x00, 0x4f, 0x0a, 0x00, 0x00, 0x65, 0x0a, 0x00, 0x00, 0x7a, 0x0a, 0x00, 0x00, 0x90, 0x0a, 0x00, 0x00,
+  0xa7, 0x0a, 0x00, 0x00, 0xb5, 0x0a, 0x00, 0x00, 0xc5, 0x0a, 0x00, 0x00, 0xd5, 0x0a, 0x00, 0x00, 0xe9, 0x0a, 0x00, 0x00, 0xfd, 0x0a, 0x00, 0x00,
+  0x0f, 0x0b, 0x00, 0x00, 0x22, 0x0b, 0x00, 0x00, 0x33, 0x0b, 0x00, 0x00, 0x44, 0x0b, 0x00, 0x00, 0x55, 0x0b, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x00,
+  0x7d, 0x0b, 0x00, 0x00, 0x92, 0x0b, 0x00, 0x00, 0xa8, 0x0b, 0x00, 0x00, 0xbd, 0x0b, 0x00, 0x00, 0xce, 0x0b, 0x00, 0x00, 0xde, 0x0b, 0x00, 0x00,
+  0xee, 0x0b, 0x00, 0x00, 0xfc, 0x0b, 0x00, 0x00, 0x0a, 0x0c, 0x00, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x2c, 0x0c, 0x00, 0x00, 0x42, 0x0c, 0x00, 0x00,
+  0x5c, 0x0c, 0x00, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x92, 0x0c, 0x00, 0x00, 0xa4, 0x0c, 0x00, 0x00, 0xe3, 0x00, 0x8d, 0x00, 0x05, 0x01, 0x02, 0x03,
+  0x04, 0x05, 0x06, 0xbb, 0x07, 0x05, 0x06, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x8d, 0x00, 0x8b, 0x00, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x0f, 0x07, 0x10,
+  0x11, 0xa8, 0x04, 0x0c, 0x12, 0x13, 0x06, 0x04, 0x14, 0x15, 0x10, 0x04, 0x10, 0x15, 0x16, 0x17, 0x18, 0x85, 0x04, 0x07, 0x11, 0x10, 0x19, 0x0f,
+  0x0f, 0x1a, 0x1b, 0x1c, 0x8b, 0x00, 0x89, 0x00, 0x06, 0x1d, 0x1e, 0x15, 0x13, 0x11, 0x1f, 0x20, 0xaa, 0x00, 0x0c, 0x02, 0x18, 0x0d, 0x21, 0x0a,
+  0x05, 0x22, 0x00, 0x23, 0x24, 0x25, 0x26, 0x27, 0x89, 0x00, 0x06, 0x1d, 0x23, 0x14, 0x28, 0x28, 0x29, 0x20, 0x89, 0x00, 0x88, 0x00, 0x04, 0x27,
+  0x2a, 0x15, 0x0d, 0x20, 0xac, 0x00, 0x0c, 0x2b, 0x18, 0x0b, 0x2c, 0x17, 0x03, 0x2d, 0x00, 0x0d, 0x2e, 0x2d, 0x00, 0x2f, 0x8d, 0x00, 0x04, 0x0c,
+  0x30, 0x28, 0x0e, 0x1f, 0x88, 0x00, 0x86, 0x00, 0x05, 0x01, 0x04, 0x0f, 0x31, 0x0b, 0x32, 0xab, 0x00, 0x06, 0x01, 0x33, 0x34, 0x01, 0x00, 0x26,
+  0x01, 0x82, 0x00, 0x00, 0x01, 0x93, 0x00, 0x03, 0x26, 0x18, 0x35, 0x30, 0x87, 0x00, 0x85, 0x00, 0x05, 0x2f, 0x36, 0x15, 0x37, 0x04, 0x02, 0xad,
+  0x00, 0x00, 0x01, 0x9e, 0x00, 0x03, 0x37, 0x35, 0x11, 0x01, 0x85, 0x00, 0x84, 0x00, 0x06, 0x01, 0x17, 0x0f, 0x38, 0x2d, 0x00, 0x39, 0xce, 0x00,
+  0x02, 0x3a, 0x15, 0x38, 0x85, 0x00, 0x84, 0x00, 0x05, 0x33, 0x35, 0x3a, 0x2b, 0x17, 0x3b, 0xd0, 0x00, 0x02, 0x3c, 0x0f, 0x2e, 0x84, 0x00, 0x83,
+  0x00, 0x02, 0x3d, 0x0f, 0x37, 0x82, 0x00, 0x02, 0x3e, 0x3f, 0x01, 0xcf, 0x00, 0x02, 0x33, 0x15, 0x40, 0x83, 0x00, 0x82, 0x00, 0x02, 0x41, 0x19,
+  0x24, 0x85, 0x00, 0x00, 0x2f, 0xcf, 0x00, 0x03, 0x2d, 0x42, 0x43, 0x01, 0x82, 0x00, 0x82, 0x00, 0x02, 0x1b, 0x28, 0x44, 0xb5, 0x00, 0x08, 0x45,
+  0x46, 0x25, 0x47, 0x1f, 0x48, 0x3d, 0x02, 0x01, 0x98, 0x00, 0x02, 0x49, 0x35, 0x34, 0x82, 0x00, 0x81, 0x00, 0x02, 0x2f, 0x2a, 0x38, 0x94, 0x00,
+  0x05, 0x2d, 0x26, 0x3d, 0x34, 0x2b, 0x0a, 0x83, 0x00, 0x05, 0x02, 0x4a, 0x2b, 0x2b, 0x22, 0x2f, 0x8e, 0x00, 0x05, 0x0b, 0x4b, 0x08, 0x15, 0x28,
+  0x4c, 0x82, 0x2a, 0x05, 0x4c, 0x28, 0x4c, 0x38, 0x47, 0x2d, 0x92, 0x00, 0x08, 0x2d, 0x21, 0x00, 0x00, 0x31, 0x19, 0x01, 0x00, 0x00, 0x81, 0x00,
+  0x02, 0x39, 0x15, 0x44, 0x8e, 0x00, 0x09, 0x2f, 0x0b, 0x00, 0x0c, 0x27, 0x36, 0x19, 0x11, 0x4d, 0x2d, 0x89, 0x00, 0x01, 0x01, 0x21, 0x8c, 0x00,
+  0x07, 0x2d, 0x04, 0x17, 0x4e, 0x22, 0x44, 0x20, 0x01, 0x83, 0x00, 0x06, 0x1c, 0x3f, 0x04, 0x2a, 0x0e, 0x0d, 0x4f, 0x90, 0x00, 0x08, 0x01, 0x50,
+  0x44, 0x00, 0x49, 0x0f, 0x22, 0x00, 0x00, 0x81, 0x00, 0x01, 0x18, 0x42, 0x8d, 0x00, 0x08, 0x45, 0x27, 0x3c, 0x3f, 0x17, 0x28, 0x07, 0x4b, 0x20,
+  0xaa, 0x00, 0x05, 0x2f, 0x03, 0x51, 0x28, 0x52, 0x26, 0x8f, 0x00, 0x07, 0x41, 0x08, 0x4f, 0x00, 0x19, 0x16, 0x00, 0x00, 0x03, 0x00, 0x20, 0x15,
+  0x4e, 0x8c, 0x00, 0x06, 0x23, 0x53, 0x54, 0x05, 0x35, 0x05, 0x48, 0xb0, 0x00, 0x04, 0x22, 0x42, 0x15, 0x30, 0x1c, 0x8e, 0x00, 0x06, 0x02, 0x24,
+  0x01, 0x0d, 0x0e, 0x2d, 0x00, 0x03, 0x00, 0x49, 0x0f, 0x49, 0x8a, 0x00, 0x06, 0x0c, 0x17, 0x18, 0x24, 0x35, 0x53, 0x49, 0xb4, 0x00, 0x04, 0x1f,
+  0x07, 0x4c, 0x4e, 0x2f, 0x8d, 0x00, 0x05, 0x2e, 0x0d, 0x3f, 0x0f, 0x2c, 0x00, 0x03, 0x00, 0x3c, 0x0f, 0x41, 0x89, 0x00, 0x05, 0x3f, 0x2a, 0x28,
+  0x35, 0x55, 0x3f, 0xb7, 0x00, 0x04, 0x2f, 0x30, 0x35, 0x19, 0x3f, 0x8c, 0x00, 0x05, 0x45, 0x51, 0x47, 0x0f, 0x23, 0x00, 0x02, 0x00, 0x29, 0x2a,
+  0x89, 0x00, 0x04, 0x4b, 0x35, 0x0f, 0x2a, 0x03, 0xbb, 0x00, 0x04, 0x4d, 0x0e, 0x0f, 0x30, 0x01, 0x8b, 0x00, 0x04, 0x22, 0x18, 0x28, 0x4e, 0x00,
+  0x02, 0x00, 0x04, 0x06, 0x87, 0x00, 0x05, 0x01, 0x09, 0x0f, 0x35, 0x38, 0x1c, 0xbd, 0x00, 0x04, 0x0c, 0x31, 0x0f, 0x14, 0x2f, 0x89, 0x00, 0x05,
+  0x02, 0x45, 0x08, 0x15, 0x30, 0x00, 0x02, 0x00, 0x38, 0x55, 0x86, 0x00, 0x04, 0x2d, 0x17, 0x0f, 0x0e, 0x22, 0xc1, 0x00, 0x03, 0x3a, 0x13, 0x08,
+  0x41, 0x88, 0x00, 0x05, 0x2f, 0x0d, 0x3e, 0x0f, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x86, 0x00, 0x03, 0x11, 0x0f, 0x05, 0x0c, 0xc3, 0x00, 0x03,
+  0x26, 0x05, 0x24, 0x2f, 0x88, 0x00, 0x04, 0x3d, 0x4e, 0x56, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x85, 0x00, 0x03, 0x3c, 0x0f, 0x12, 0x45, 0xc5,
+  0x00, 0x03, 0x01, 0x4b, 0x17, 0x2d, 0x88, 0x00, 0x03, 0x31, 0x13, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x84, 0x00, 0x02, 0x3a, 0x35, 0x0d, 0xc9,
+  0x00, 0x01, 0x3d, 0x0d, 0x88, 0x00, 0x03, 0x57, 0x0f, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x83, 0x00, 0x02, 0x3e, 0x15, 0x4e, 0xd4, 0x00, 0x04,
+  0x1c, 0x00, 0x19, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x82, 0x00, 0x02, 0x21, 0x19, 0x2b, 0xcd, 0x00, 0x02, 0x01, 0x4d, 0x2c, 0x83, 0x00, 0x05,
+  0x01, 0x36, 0x3d, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x82, 0x00, 0x01, 0x41, 0x3e, 0xce, 0x00, 0x04, 0x20, 0x30, 0x58, 0x10, 0x0c, 0x82,
+  0x00, 0x04, 0x59, 0x0e, 0x13, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x82, 0x00, 0x02, 0x45, 0x32, 0x01, 0xcf, 0x00, 0x02, 0x48, 0x27, 0x41, 0x83,
+  0x00, 0x03, 0x3c, 0x0f, 0x50, 0x00, 0x07, 0x00, 0x38, 0x55, 0x00, 0x00, 0x03, 0x14, 0x3f, 0xd0, 0x00, 0x03, 0x4b, 0x06, 0x05, 0x02, 0x82, 0x00,
+  0x03, 0x01, 0x13, 0x50, 0x00, 0x07, 0x00, 0x38, 0x55, 0x00, 0x00, 0x26, 0x00, 0x01, 0xc3, 0x00, 0x11, 0x21, 0x25, 0x48, 0x03, 0x2e, 0x5a, 0x33,
+  0x0d, 0x2b, 0x22, 0x44, 0x45, 0x00, 0x00, 0x2d, 0x4b, 0x2a, 0x3c, 0x82, 0x00, 0x02, 0x07, 0x50, 0x00, 0x08, 0x00, 0x38, 0x55, 0x00, 0x00, 0x47,
+  0x31, 0x1e, 0x2d, 0xbe, 0x00, 0x04, 0x2f, 0x47, 0x29, 0x24, 0x28, 0x89, 0x0f, 0x0c, 0x4c, 0x31, 0x03, 0x0b, 0x22, 0x25, 0x1e, 0x41, 0x00, 0x00,
+  0x07, 0x50, 0x00, 0x06, 0x00, 0x38, 0x55, 0x26, 0x53, 0x58, 0x3e, 0x86, 0x00, 0x08, 0x2d, 0x0c, 0x32, 0x5b, 0x33, 0x5c, 0x18, 0x43, 0x19, 0x83,
+  0x2a, 0x04, 0x0e, 0x43, 0x04, 0x48, 0x45, 0xa5, 0x00, 0x02, 0x0b, 0x1e, 0x28, 0x82, 0x0f, 0x09, 0x15, 0x28, 0x2a, 0x2a, 0x0e, 0x0e, 0x2a, 0x2a,
+  0x28, 0x35, 0x85, 0x0f, 0x07, 0x28, 0x4e, 0x01, 0x00, 0x00, 0x07, 0x50, 0x00, 0x1b, 0x00, 0x38, 0x55, 0x24, 0x27, 0x26, 0x30, 0x41, 0x00, 0x00,
+  0x0c, 0x22, 0x5a, 0x08, 0x0e, 0x0f, 0x0f, 0x13, 0x07, 0x51, 0x51, 0x42, 0x08, 0x24, 0x08, 0x43, 0x07, 0x28, 0x82, 0x0f, 0x01, 0x1a, 0x48, 0xa2,
+  0x00, 0x0a, 0x0c, 0x38, 0x35, 0x0f, 0x56, 0x09, 0x27, 0x25, 0x4f, 0x20, 0x2d, 0x83, 0x00, 0x06, 0x01, 0x20, 0x26, 0x3f, 0x2e, 0x53, 0x2a, 0x83,
+  0x0f, 0x05, 0x18, 0x4d, 0x01, 0x07, 0x50, 0x00, 0x11, 0x00, 0x38, 0x55, 0x01, 0x3c, 0x36, 0x1d, 0x41, 0x0a, 0x05, 0x15, 0x0f, 0x0f, 0x43, 0x33,
+  0x48, 0x59, 0x2d, 0x88, 0x00, 0x07, 0x45, 0x02, 0x37, 0x51, 0x0f, 0x0f, 0x11, 0x45, 0x9f, 0x00, 0x05, 0x03, 0x28, 0x0f, 0x1a, 0x3c, 0x45, 0x8f,
+  0x00, 0x03, 0x45, 0x3d, 0x16, 0x15, 0x82, 0x0f, 0x03, 0x55, 0x13, 0x50, 0x00, 0x0c, 0x00, 0x38, 0x1a, 0x36, 0x4e, 0x46, 0x5a, 0x4c, 0x0f, 0x35,
+  0x43, 0x4b, 0x59, 0x91, 0x00, 0x04, 0x3f, 0x56, 0x0f, 0x31, 0x01, 0x9c, 0x00, 0x05, 0x2f, 0x17, 0x0f, 0x4c, 0x1b, 0x01, 0x83, 0x00, 0x02, 0x01,
+  0x2f, 0x45, 0x8d, 0x00, 0x02, 0x20, 0x4e, 0x19, 0x82, 0x0f, 0x01, 0x50, 0x00, 0x09, 0x00, 0x38, 0x28, 0x3c, 0x17, 0x35, 0x0f, 0x28, 0x5c, 0x25,
+  0x8a, 0x00, 0x05, 0x5d, 0x5b, 0x5b, 0x34, 0x48, 0x1d, 0x84, 0x00, 0x03, 0x25, 0x15, 0x0f, 0x3c, 0x9c, 0x00, 0x03, 0x1e, 0x0f, 0x36, 0x59, 0x83,
+  0x00, 0x06, 0x47, 0x08, 0x0e, 0x35, 0x28, 0x12, 0x1c, 0x8d, 0x00, 0x05, 0x45, 0x3a, 0x07, 0x0f, 0x50, 0x00, 0x07, 0x00, 0x38, 0x35, 0x35, 0x0f,
+  0x15, 0x09, 0x59, 0x8a, 0x00, 0x02, 0x01, 0x30, 0x35, 0x83, 0x0f, 0x01, 0x4c, 0x23, 0x84, 0x00, 0x02, 0x5c, 0x0f, 0x05, 0x9b, 0x00, 0x02, 0x2f,
+  0x28, 0x04, 0x84, 0x00, 0x01, 0x2e, 0x35, 0x84, 0x0f, 0x01, 0x06, 0x1d, 0x8e, 0x00, 0x03, 0x2d, 0x56, 0x50, 0x00, 0x05, 0x00, 0x38, 0x0f, 0x15,
+  0x38, 0x26, 0x8c, 0x00, 0x00, 0x5a, 0x87, 0x0f, 0x00, 0x32, 0x83, 0x00, 0x03, 0x54, 0x0f, 0x19, 0x01, 0x9a, 0x00, 0x02, 0x3f, 0x0f, 0x1f, 0x83,
+  0x00, 0x00, 0x39, 0x87, 0x0f, 0x00, 0x31, 0x8f, 0x00, 0x02, 0x07, 0x50, 0x00, 0x03, 0x00, 0x38, 0x13, 0x25, 0x8d, 0x00, 0x01, 0x5d, 0x35, 0x87,
+  0x0f, 0x00, 0x05, 0x83, 0x00, 0x03, 0x4e, 0x0f, 0x19, 0x01, 0x9a, 0x00, 0x02, 0x2b, 0x0f, 0x3e, 0x82, 0x00, 0x01, 0x01, 0x19, 0x88, 0x0f, 0x00,
+  0x3b, 0x8e, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x8e, 0x00, 0x00, 0x1e, 0x88, 0x0f, 0x01, 0x28, 0x1d, 0x82, 0x00, 0x02, 0x33,
+  0x0f, 0x55, 0x9b, 0x00, 0x02, 0x4b, 0x0f, 0x4d, 0x82, 0x00, 0x00, 0x57, 0x89, 0x0f, 0x00, 0x5a, 0x8e, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00,
+  0x38, 0x55, 0x8e, 0x00, 0x00, 0x2a, 0x89, 0x0f, 0x00, 0x47, 0x82, 0x00, 0x02, 0x24, 0x0f, 0x17, 0x9b, 0x00, 0x02, 0x2b, 0x0f, 0x1f, 0x82, 0x00,
+  0x00, 0x27, 0x89, 0x0f, 0x00, 0x31, 0x8e, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x8d, 0x00, 0x01, 0x2f, 0x35, 0x89, 0x0f, 0x06,
+  0x22, 0x00, 0x00, 0x2f, 0x4c, 0x0f, 0x4b, 0x9b, 0x00, 0x02, 0x22, 0x0f, 0x2e, 0x82, 0x00, 0x00, 0x34, 0x89, 0x0f, 0x00, 0x58, 0x8e, 0x00, 0x02,
+  0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x8d, 0x00, 0x01, 0x41, 0x35, 0x89, 0x0f, 0x06, 0x57, 0x00, 0x00, 0x49, 0x0f, 0x0f, 0x25, 0x9b, 0x00,
+  0x02, 0x26, 0x0f, 0x08, 0x82, 0x00, 0x00, 0x3c, 0x89, 0x0f, 0x00, 0x43, 0x8e, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x8d, 0x00,
+  0x01, 0x2d, 0x2a, 0x88, 0x0f, 0x00, 0x43, 0x82, 0x00, 0x03, 0x11, 0x0f, 0x4c, 0x2f, 0x9c, 0x00, 0x06, 0x43, 0x28, 0x0c, 0x00, 0x00, 0x44, 0x35,
+  0x88, 0x0f, 0x00, 0x54, 0x8e, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x8e, 0x00, 0x00, 0x3a, 0x88, 0x0f, 0x06, 0x23, 0x00, 0x00,
+  0x44, 0x15, 0x0f, 0x17, 0x89, 0x00, 0x03, 0x01, 0x21, 0x1c, 0x21, 0x8f, 0x00, 0x02, 0x3c, 0x0f, 0x1e, 0x82, 0x00, 0x00, 0x30, 0x87, 0x0f, 0x01,
+  0x42, 0x01, 0x8e, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x8f, 0x00, 0x00, 0x17, 0x85, 0x0f, 0x01, 0x35, 0x1e, 0x82, 0x00, 0x03,
+  0x17, 0x0f, 0x0f, 0x3f, 0x86, 0x00, 0x0f, 0x2d, 0x23, 0x14, 0x07, 0x06, 0x43, 0x42, 0x53, 0x10, 0x18, 0x08, 0x31, 0x1e, 0x3c, 0x02, 0x01, 0x86,
+  0x00, 0x03, 0x45, 0x19, 0x35, 0x47, 0x82, 0x00, 0x01, 0x3c, 0x19, 0x84, 0x0f, 0x01, 0x18, 0x1c, 0x8f, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00,
+  0x38, 0x55, 0x8f, 0x00, 0x07, 0x01, 0x30, 0x35, 0x0f, 0x0f, 0x35, 0x51, 0x3d, 0x82, 0x00, 0x03, 0x3c, 0x0f, 0x0f, 0x05, 0x86, 0x00, 0x04, 0x3f,
+  0x05, 0x37, 0x02, 0x01, 0x82, 0x00, 0x83, 0x01, 0x06, 0x41, 0x59, 0x25, 0x3a, 0x04, 0x30, 0x5d, 0x85, 0x00, 0x03, 0x22, 0x0f, 0x13, 0x02, 0x82,
+  0x00, 0x05, 0x01, 0x3f, 0x37, 0x04, 0x09, 0x27, 0x91, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x91, 0x00, 0x03, 0x1d, 0x25, 0x25,
+  0x1c, 0x83, 0x00, 0x04, 0x22, 0x35, 0x0f, 0x28, 0x5d, 0x85, 0x00, 0x14, 0x5e, 0x08, 0x5d, 0x0a, 0x29, 0x16, 0x05, 0x06, 0x51, 0x58, 0x18, 0x31,
+  0x17, 0x16, 0x52, 0x2e, 0x1f, 0x1c, 0x59, 0x5a, 0x22, 0x85, 0x00, 0x03, 0x0d, 0x0f, 0x2a, 0x47, 0x99, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00,
+  0x38, 0x55, 0x98, 0x00, 0x04, 0x4a, 0x15, 0x0f, 0x35, 0x27, 0x85, 0x00, 0x03, 0x2b, 0x10, 0x3f, 0x07, 0x82, 0x0f, 0x01, 0x36, 0x1c, 0x85, 0x00,
+  0x07, 0x41, 0x3d, 0x18, 0x4c, 0x5a, 0x00, 0x0d, 0x22, 0x85, 0x00, 0x04, 0x1b, 0x15, 0x35, 0x38, 0x46, 0x97, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02,
+  0x00, 0x38, 0x55, 0x96, 0x00, 0x05, 0x59, 0x38, 0x0f, 0x0f, 0x15, 0x27, 0x85, 0x00, 0x03, 0x4d, 0x05, 0x44, 0x28, 0x83, 0x0f, 0x06, 0x0e, 0x4b,
+  0x22, 0x3e, 0x02, 0x21, 0x2d, 0x83, 0x00, 0x05, 0x0d, 0x0f, 0x3f, 0x45, 0x58, 0x1d, 0x85, 0x00, 0x07, 0x25, 0x05, 0x0f, 0x35, 0x10, 0x34, 0x02,
+  0x45, 0x93, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x92, 0x00, 0x08, 0x01, 0x1d, 0x22, 0x17, 0x35, 0x0f, 0x0f, 0x05, 0x57, 0x85,
+  0x00, 0x03, 0x41, 0x0e, 0x3b, 0x5a, 0x89, 0x0f, 0x0b, 0x43, 0x5a, 0x44, 0x52, 0x2e, 0x3b, 0x46, 0x15, 0x11, 0x00, 0x3d, 0x12, 0x87, 0x00, 0x02,
+  0x3e, 0x16, 0x13, 0x82, 0x0f, 0x16, 0x56, 0x06, 0x55, 0x55, 0x06, 0x1a, 0x0e, 0x13, 0x15, 0x0f, 0x0f, 0x35, 0x28, 0x19, 0x18, 0x1e, 0x27, 0x26,
+  0x00, 0x00, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x87, 0x00, 0x12, 0x20, 0x44, 0x25, 0x3f, 0x23, 0x03, 0x4b, 0x2e, 0x5a, 0x04, 0x24, 0x19,
+  0x15, 0x0f, 0x0f, 0x35, 0x05, 0x23, 0x01, 0x86, 0x00, 0x03, 0x54, 0x56, 0x2d, 0x0e, 0x8a, 0x0f, 0x01, 0x28, 0x15, 0x82, 0x0f, 0x06, 0x13, 0x0f,
+  0x1a, 0x00, 0x00, 0x08, 0x44, 0x88, 0x00, 0x0b, 0x41, 0x3e, 0x4b, 0x09, 0x17, 0x18, 0x05, 0x58, 0x43, 0x51, 0x1a, 0x2a, 0x88, 0x0f, 0x05, 0x35,
+  0x43, 0x03, 0x19, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x82, 0x00, 0x05, 0x01, 0x4d, 0x0d, 0x05, 0x4c, 0x15, 0x8a, 0x0f, 0x03, 0x35, 0x42, 0x4e,
+  0x26, 0x89, 0x00, 0x03, 0x07, 0x5c, 0x00, 0x4c, 0x91, 0x0f, 0x04, 0x2a, 0x01, 0x00, 0x22, 0x38, 0x93, 0x00, 0x05, 0x01, 0x41, 0x25, 0x5b, 0x31,
+  0x28, 0x87, 0x0f, 0x01, 0x50, 0x00, 0x06, 0x00, 0x38, 0x55, 0x01, 0x3e, 0x04, 0x13, 0x85, 0x0f, 0x0a, 0x35, 0x2a, 0x05, 0x52, 0x1b, 0x27, 0x22,
+  0x3f, 0x3e, 0x5d, 0x2f, 0x8b, 0x00, 0x04, 0x39, 0x15, 0x25, 0x00, 0x2a, 0x91, 0x0f, 0x05, 0x2a, 0x00, 0x00, 0x01, 0x42, 0x26, 0x97, 0x00, 0x03,
+  0x2f, 0x39, 0x08, 0x35, 0x84, 0x0f, 0x01, 0x50, 0x00, 0x03, 0x00, 0x38, 0x2a, 0x51, 0x85, 0x0f, 0x04, 0x13, 0x36, 0x2b, 0x44, 0x45, 0x93, 0x00,
+  0x05, 0x02, 0x28, 0x54, 0x00, 0x00, 0x16, 0x91, 0x0f, 0x00, 0x36, 0x82, 0x00, 0x01, 0x48, 0x17, 0x9a, 0x00, 0x01, 0x25, 0x10, 0x83, 0x0f, 0x01,
+  0x50, 0x00, 0x01, 0x00, 0x38, 0x84, 0x0f, 0x03, 0x15, 0x36, 0x48, 0x45, 0x96, 0x00, 0x02, 0x1c, 0x1a, 0x04, 0x82, 0x00, 0x00, 0x49, 0x90, 0x0f,
+  0x01, 0x35, 0x25, 0x83, 0x00, 0x01, 0x08, 0x4a, 0x9b, 0x00, 0x05, 0x3f, 0x06, 0x0f, 0x0f, 0x50, 0x00, 0x01, 0x00, 0x38, 0x82, 0x0f, 0x02, 0x56,
+  0x2e, 0x0c, 0x98, 0x00, 0x03, 0x41, 0x05, 0x18, 0x01, 0x83, 0x00, 0x01, 0x2e, 0x35, 0x8d, 0x0f, 0x01, 0x28, 0x3c, 0x84, 0x00, 0x02, 0x2c, 0x0e,
+  0x5d, 0x9b, 0x00, 0x04, 0x45, 0x30, 0x0f, 0x50, 0x00, 0x05, 0x00, 0x38, 0x0f, 0x15, 0x33, 0x2f, 0x91, 0x00, 0x01, 0x2f, 0x01, 0x85, 0x00, 0x03,
+  0x21, 0x08, 0x55, 0x20, 0x85, 0x00, 0x0f, 0x02, 0x2e, 0x5c, 0x05, 0x55, 0x06, 0x1a, 0x19, 0x19, 0x07, 0x06, 0x42, 0x17, 0x30, 0x3c, 0x26, 0x86,
+  0x00, 0x02, 0x23, 0x19, 0x2c, 0x85, 0x00, 0x01, 0x1c, 0x2f, 0x94, 0x00, 0x02, 0x1a, 0x50, 0x00, 0x03, 0x00, 0x38, 0x4c, 0x3e, 0x8f, 0x00, 0x05,
+  0x2d, 0x22, 0x29, 0x43, 0x4c, 0x50, 0x84, 0x00, 0x03, 0x26, 0x43, 0x51, 0x0c, 0x8c, 0x00, 0x82, 0x01, 0x8e, 0x00, 0x02, 0x5b, 0x0e, 0x3b, 0x83,
+  0x00, 0x05, 0x2d, 0x56, 0x4c, 0x12, 0x47, 0x2f, 0x91, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x90, 0x00, 0x00, 0x3e, 0x84, 0x0f,
+  0x07, 0x1e, 0x59, 0x4f, 0x0b, 0x54, 0x13, 0x31, 0x21, 0xa0, 0x00, 0x06, 0x0a, 0x2a, 0x03, 0x01, 0x2d, 0x48, 0x06, 0x83, 0x0f, 0x01, 0x56, 0x2d,
+  0x90, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x91, 0x00, 0x04, 0x27, 0x1e, 0x23, 0x11, 0x2a, 0x83, 0x0f, 0x01, 0x51, 0x3c, 0xa3,
+  0x00, 0x0a, 0x44, 0x07, 0x55, 0x19, 0x0f, 0x0f, 0x43, 0x0a, 0x3c, 0x1e, 0x3e, 0x91, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x95,
+  0x00, 0x08, 0x2f, 0x4e, 0x15, 0x0f, 0x0f, 0x56, 0x29, 0x3e, 0x2f, 0x8f, 0x00, 0x03, 0x2d, 0x41, 0x1c, 0x2d, 0x8a, 0x00, 0x03, 0x2f, 0x49, 0x0d,
+  0x1a, 0x82, 0x0f, 0x01, 0x18, 0x47, 0x96, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x97, 0x00, 0x26, 0x5c, 0x0d, 0x24, 0x28, 0x0f,
+  0x0f, 0x15, 0x05, 0x30, 0x34, 0x23, 0x47, 0x3f, 0x3f, 0x22, 0x3c, 0x2e, 0x1e, 0x17, 0x58, 0x19, 0x06, 0x17, 0x18, 0x0e, 0x28, 0x35, 0x1a, 0x31,
+  0x0d, 0x3c, 0x27, 0x4a, 0x4a, 0x27, 0x2b, 0x1e, 0x58, 0x35, 0x82, 0x0f, 0x02, 0x28, 0x31, 0x39, 0x98, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00,
+  0x38, 0x55, 0x97, 0x00, 0x07, 0x52, 0x53, 0x32, 0x2f, 0x40, 0x2e, 0x18, 0x2a, 0x88, 0x0f, 0x04, 0x28, 0x58, 0x0d, 0x25, 0x01, 0x82, 0x00, 0x04,
+  0x4f, 0x3d, 0x50, 0x43, 0x28, 0x86, 0x0f, 0x07, 0x4c, 0x1a, 0x08, 0x1e, 0x4a, 0x1d, 0x20, 0x0c, 0x98, 0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00,
+  0x38, 0x55, 0x97, 0x00, 0x02, 0x57, 0x52, 0x5e, 0x83, 0x00, 0x0a, 0x45, 0x57, 0x4b, 0x4e, 0x5b, 0x3c, 0x23, 0x3d, 0x3f, 0x3e, 0x41, 0x8a, 0x00,
+  0x0e, 0x21, 0x3b, 0x22, 0x27, 0x27, 0x1f, 0x25, 0x0c, 0x2f, 0x01, 0x00, 0x00, 0x01, 0x4a, 0x5b, 0x99, 0x00, 0x02, 0x07, 0x50, 0x00, 0x05, 0x00,
+  0x38, 0x55, 0x00, 0x00, 0x49, 0x95, 0x00, 0x03, 0x0a, 0x04, 0x38, 0x2f, 0xa1, 0x00, 0x03, 0x45, 0x27, 0x43, 0x27, 0x9a, 0x00, 0x02, 0x07, 0x50,
+  0x00, 0x05, 0x00, 0x38, 0x55, 0x00, 0x00, 0x42, 0x96, 0x00, 0x03, 0x46, 0x43, 0x36, 0x5d, 0x9d, 0x00, 0x05, 0x2d, 0x3b, 0x30, 0x06, 0x1e, 0x0c,
+  0x9b, 0x00, 0x02, 0x07, 0x50, 0x00, 0x05, 0x00, 0x38, 0x55, 0x00, 0x00, 0x53, 0x97, 0x00, 0x07, 0x20, 0x2d, 0x39, 0x27, 0x00, 0x00, 0x44, 0x3e,
+  0x96, 0x00, 0x05, 0x45, 0x33, 0x06, 0x31, 0x03, 0x20, 0x9d, 0x00, 0x02, 0x07, 0x50, 0x00, 0x05, 0x00, 0x38, 0x55, 0x00, 0x00, 0x0d, 0x9d, 0x00,
+  0x01, 0x5b, 0x10, 0x97, 0x00, 0x00, 0x0c, 0xa1, 0x00, 0x02, 0x07, 0x50, 0x00, 0x06, 0x00, 0x38, 0x55, 0x00, 0x00, 0x22, 0x46, 0x9c, 0x00, 0x03,
+  0x25, 0x4c, 0x5d, 0x16, 0xb8, 0x00, 0x02, 0x07, 0x50, 0x00, 0x06, 0x00, 0x38, 0x55, 0x00, 0x00, 0x44, 0x43, 0x9d, 0x00, 0x04, 0x4e, 0x3c, 0x58,
+  0x20, 0x52, 0xb6, 0x00, 0x02, 0x07, 0x50, 0x00, 0x07, 0x00, 0x38, 0x55, 0x00, 0x00, 0x03, 0x28, 0x20, 0x9d, 0x00, 0x04, 0x1c, 0x02, 0x46, 0x25,
+  0x2d, 0xb5, 0x00, 0x02, 0x07, 0x50, 0x00, 0x06, 0x00, 0x38, 0x55, 0x00, 0x00, 0x30, 0x18, 0xd9, 0x00, 0x02, 0x07, 0x50, 0x00, 0x08, 0x00, 0x38,
+  0x55, 0x00, 0x00, 0x10, 0x4b, 0x5e, 0x01, 0xd7, 0x00, 0x02, 0x07, 0x50, 0x00, 0x08, 0x00, 0x38, 0x55, 0x00, 0x00, 0x23, 0x40, 0x4c, 0x20, 0xd7,
+  0x00, 0x02, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38, 0x55, 0x82, 0x00, 0x03, 0x4e, 0x16, 0x2f, 0x2f, 0xd3, 0x00, 0x05, 0x5d, 0x00, 0x00, 0x07, 0x50,
+  0x00, 0x02, 0x00, 0x38, 0x55, 0x82, 0x00, 0x03, 0x33, 0x3e, 0x36, 0x0c, 0xd3, 0x00, 0x05, 0x16, 0x0c, 0x00, 0x07, 0x50, 0x00, 0x02, 0x00, 0x38,
+  0x55, 0x83, 0x00, 0x01, 0x49, 0x12, 0xd4, 0x00, 0x05, 0x4c, 0x02, 0x00, 0x07, 0x50, 0x00, 0x08, 0x00, 0x38, 0x55, 0x00, 0x45, 0x00, 0x00, 0x20,
+  0x20, 0xd4, 0x00, 0x05, 0x24, 0x21, 0x00, 0x07, 0x50, 0x00, 0x04, 0x00, 0x38, 0x55, 0x45, 0x0d, 0xd6, 0x00, 0x07, 0x2f, 0x20, 0x57, 0x00, 0x00,
+  0x07, 0x50, 0x00, 0x04, 0x00, 0x04, 0x06, 0x40, 0x52, 0xd6, 0x00, 0x01, 0x03, 0x30, 0x82, 0x00, 0x02, 0x19, 0x30, 0x00, 0x04, 0x00, 0x0d, 0x13,
+  0x37, 0x3f, 0xd6, 0x00, 0x01, 0x11, 0x51, 0x82, 0x00, 0x02, 0x28, 0x4e, 0x00, 0x05, 0x00, 0x3c, 0x0f, 0x18, 0x20, 0x3e, 0xd4, 0x00, 0x08, 0x25,
+  0x27, 0x56, 0x00, 0x00, 0x0c, 0x0f, 0x23, 0x00, 0x06, 0x00, 0x25, 0x0f, 0x51, 0x2d, 0x56, 0x41, 0xd2, 0x00, 0x09, 0x01, 0x06, 0x0c, 0x1b, 0x00,
+  0x00, 0x3f, 0x0f, 0x46, 0x00, 0x06, 0x00, 0x20, 0x28, 0x05, 0x59, 0x15, 0x2f, 0xd2, 0x00, 0x02, 0x01, 0x4c, 0x20, 0x82, 0x00, 0x03, 0x0d, 0x0e,
+  0x2d, 0x00, 0x81, 0x00, 0x05, 0x10, 0x06, 0x2c, 0x58, 0x1d, 0x26, 0xd1, 0x00, 0x09, 0x01, 0x07, 0x41, 0x00, 0x00, 0x01, 0x19, 0x5c, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x23, 0x35, 0x4d, 0x29, 0x02, 0x16, 0xd2, 0x00, 0x00, 0x4e, 0x82, 0x00, 0x04, 0x3e, 0x0f, 0x22, 0x00, 0x00, 0x81, 0x00, 0x05,
+  0x45, 0x0e, 0x5c, 0x26, 0x0b, 0x53, 0xd6, 0x00, 0x04, 0x10, 0x19, 0x01, 0x00, 0x00, 0x82, 0x00, 0x04, 0x5b, 0x15, 0x02, 0x0c, 0x30, 0xd5, 0x00,
+  0x02, 0x3e, 0x35, 0x3c, 0x82, 0x00, 0x82, 0x00, 0x04, 0x45, 0x07, 0x58, 0x2d, 0x46, 0xd4, 0x00, 0x02, 0x2d, 0x43, 0x43, 0x83, 0x00, 0x83, 0x00,
+  0x02, 0x3f, 0x35, 0x29, 0xd5, 0x00, 0x02, 0x50, 0x28, 0x25, 0x83, 0x00, 0x84, 0x00, 0x02, 0x0d, 0x35, 0x3a, 0xd3, 0x00, 0x02, 0x2b, 0x0f, 0x1b,
+  0x84, 0x00, 0x85, 0x00, 0x02, 0x11, 0x15, 0x27, 0xd1, 0x00, 0x02, 0x3c, 0x35, 0x04, 0x85, 0x00, 0x85, 0x00, 0x03, 0x2d, 0x17, 0x0f, 0x4e, 0x86,
+  0x00, 0x00, 0x39, 0xc6, 0x00, 0x03, 0x01, 0x5e, 0x0f, 0x11, 0x86, 0x00, 0x86, 0x00, 0x04, 0x01, 0x33, 0x35, 0x31, 0x2c, 0x84, 0x00, 0x01, 0x5b,
+  0x32, 0xc4, 0x00, 0x03, 0x44, 0x18, 0x35, 0x29, 0x87, 0x00, 0x88, 0x00, 0x04, 0x1f, 0x56, 0x28, 0x30, 0x4f, 0x82, 0x00, 0x04, 0x25, 0x55, 0x00,
+  0x00, 0x01, 0xbf, 0x00, 0x04, 0x26, 0x50, 0x28, 0x19, 0x3d, 0x88, 0x00, 0x89, 0x00, 0x0b, 0x21, 0x50, 0x28, 0x15, 0x16, 0x23, 0x3f, 0x2f, 0x4c,
+  0x3b, 0x2b, 0x25, 0xbc, 0x00, 0x06, 0x0c, 0x23, 0x14, 0x35, 0x28, 0x29, 0x2f, 0x89, 0x00, 0x8b, 0x00, 0x0a, 0x0c, 0x2e, 0x06, 0x35, 0x0f, 0x19,
+  0x4c, 0x42, 0x13, 0x31, 0x17, 0xb8, 0x04, 0x07, 0x11, 0x18, 0x19, 0x0f, 0x15, 0x55, 0x4e, 0x1c, 0x8b, 0x00, 0x8e, 0x00, 0x04, 0x26, 0x0a, 0x1e,
+  0x31, 0x05, 0xbb, 0x42, 0x04, 0x05, 0x31, 0x50, 0x27, 0x59, 0x8e, 0x00, 0xe3, 0x00,
 };
 
 const lv_img_dsc_t img_sloth_desc = {
-    .header = {.cf = LV_IMG_CF_TRUE_COLOR, .w = 100, .h = 100},
+    .header = {.cf = LV_IMG_CF_USER_ENCODED_0, .w = 100, .h = 100},
     .data_size = sizeof(img_sloth_map),
     .data = img_sloth_map,
 };
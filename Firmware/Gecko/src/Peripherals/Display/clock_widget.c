@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <lvgl.h>
+
+#include "console.h"
+#include "clock_widget.h"
+
+#define CLOCK_GLYPHS        "0123456789:APM"
+#define CLOCK_GLYPH_COUNT   (sizeof(CLOCK_GLYPHS) - 1)
+#define CLOCK_GLYPH_POOL    4096 // A8 bitmaps for every glyph, montserrat 24 takes about 3 kB
+
+// One image per character position, the gap between the minutes and AM/PM is just spacing
+typedef enum {
+    SLOT_HOUR_TENS = 0,
+    SLOT_HOUR_ONES,
+    SLOT_COLON,
+    SLOT_MINUTE_TENS,
+    SLOT_MINUTE_ONES,
+    SLOT_MERIDIEM,
+    SLOT_M,
+    SLOT_COUNT
+} Clock_Slot;
+
+typedef struct {
+    lv_img_dsc_t img;
+    lv_coord_t adv_w;   // Advance width of the glyph
+    lv_coord_t ofs_x;   // Where the bitmap sits relative to the pen position
+    lv_coord_t ofs_y;   //  and the top of the line
+} Clock_Glyph;
+
+// Rasterised once out of the font, lives outside the LVGL heap
+static struct {
+    const lv_font_t* font;
+    Clock_Glyph glyphs[CLOCK_GLYPH_COUNT];
+    lv_coord_t slot_w[SLOT_COUNT];  // Digits share the widest digit's width so nothing shifts
+    lv_coord_t gap_w;
+    lv_coord_t height;
+    uint8_t pool[CLOCK_GLYPH_POOL];
+    uint32_t pool_used;
+} glyph_cache;
+
+typedef struct {
+    lv_obj_t* slots[SLOT_COUNT];
+    char shown[SLOT_COUNT]; // Character in each slot, 0 while empty
+} Clock_Widget;
+
+// Expand a 1/2/4/8 bpp glyph bitmap (packed MSB first, no row padding) to 8 bit alpha
+static void glyph_unpack(const uint8_t* src, uint8_t bpp, uint32_t count, uint8_t* dst)
+{
+    uint8_t mask = (1 << bpp) - 1;
+    uint32_t bit = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t value = (src[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+        dst[i] = value * 255 / mask;
+        bit += bpp;
+    }
+}
+
+static const Clock_Glyph* glyph_get(char c)
+{
+    const char* found = strchr(CLOCK_GLYPHS, c);
+
+    return (c && found) ? &glyph_cache.glyphs[found - CLOCK_GLYPHS] : NULL;
+}
+
+static int glyph_cache_build(const lv_font_t* font)
+{
+    if (glyph_cache.font == font) return 0;
+    if (glyph_cache.font) return -EINVAL;
+
+    for (int i = 0; i < CLOCK_GLYPH_COUNT; i++)
+    {
+        Clock_Glyph* glyph = &glyph_cache.glyphs[i];
+        lv_font_glyph_dsc_t dsc;
+        const uint8_t* bitmap;
+        uint32_t size;
+
+        if (!lv_font_get_glyph_dsc(font, &dsc, CLOCK_GLYPHS[i], 0)) return -ENOENT;
+        size = dsc.box_w * dsc.box_h;
+        if (glyph_cache.pool_used + size > CLOCK_GLYPH_POOL) return -ENOMEM;
+
+        bitmap = lv_font_get_glyph_bitmap(font, CLOCK_GLYPHS[i]);
+        if (!bitmap) return -ENOENT;
+        glyph_unpack(bitmap, dsc.bpp, size, &glyph_cache.pool[glyph_cache.pool_used]);
+
+        glyph->img.header.cf = LV_IMG_CF_ALPHA_8BIT;
+        glyph->img.header.w = dsc.box_w;
+        glyph->img.header.h = dsc.box_h;
+        glyph->img.data_size = size;
+        glyph->img.data = &glyph_cache.pool[glyph_cache.pool_used];
+        glyph->adv_w = dsc.adv_w;
+        glyph->ofs_x = dsc.ofs_x;
+        glyph->ofs_y = font->line_height - font->base_line - dsc.ofs_y - dsc.box_h;
+        glyph_cache.pool_used += size;
+    }
+
+    for (char c = '0'; c <= '9'; c++)
+    {
+        glyph_cache.slot_w[SLOT_HOUR_TENS] = LV_MAX(glyph_cache.slot_w[SLOT_HOUR_TENS], glyph_get(c)->adv_w);
+    }
+    glyph_cache.slot_w[SLOT_HOUR_ONES] = glyph_cache.slot_w[SLOT_HOUR_TENS];
+    glyph_cache.slot_w[SLOT_MINUTE_TENS] = glyph_cache.slot_w[SLOT_HOUR_TENS];
+    glyph_cache.slot_w[SLOT_MINUTE_ONES] = glyph_cache.slot_w[SLOT_HOUR_TENS];
+    glyph_cache.slot_w[SLOT_COLON] = glyph_get(':')->adv_w;
+    glyph_cache.slot_w[SLOT_MERIDIEM] = LV_MAX(glyph_get('A')->adv_w, glyph_get('P')->adv_w);
+    glyph_cache.slot_w[SLOT_M] = glyph_get('M')->adv_w;
+    glyph_cache.gap_w = lv_font_get_glyph_width(font, ' ', 0);
+    glyph_cache.height = font->line_height;
+    glyph_cache.font = font;
+
+    return 0;
+}
+
+static lv_coord_t slot_x(Clock_Slot slot)
+{
+    lv_coord_t x = 0;
+
+    for (Clock_Slot i = SLOT_HOUR_TENS; i < slot; i++) x += glyph_cache.slot_w[i];
+    if (slot >= SLOT_MERIDIEM) x += glyph_cache.gap_w;
+    return x;
+}
+
+static lv_coord_t clock_width(void)
+{
+    return slot_x(SLOT_M) + glyph_cache.slot_w[SLOT_M];
+}
+
+// Point a slot at a cached glyph (or hide it), centered in its cell
+static void slot_show(Clock_Widget* widget, Clock_Slot slot, char c)
+{
+    lv_obj_t* img = widget->slots[slot];
+    const Clock_Glyph* glyph = glyph_get(c);
+
+    widget->shown[slot] = c;
+    if (!glyph)
+    {
+        lv_obj_add_flag(img, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    lv_img_set_src(img, &glyph->img);
+    lv_obj_set_pos(img, slot_x(slot) + (glyph_cache.slot_w[slot] - glyph->adv_w) / 2 + glyph->ofs_x, glyph->ofs_y);
+    lv_obj_clear_flag(img, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void clock_widget_delete_cb(lv_event_t* e)
+{
+    lv_obj_t* clock = lv_event_get_target(e);
+
+    lv_mem_free(lv_obj_get_user_data(clock));
+    lv_obj_set_user_data(clock, NULL);
+}
+
+lv_obj_t* clock_widget_create(lv_obj_t* parent, const lv_font_t* font, lv_color_t color)
+{
+    lv_obj_t* clock = lv_obj_create(parent);
+    Clock_Widget* widget;
+    int err;
+
+    lv_obj_remove_style_all(clock);
+    lv_obj_clear_flag(clock, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+
+    err = glyph_cache_build(font);
+    if (err)
+    {
+        printf(ANSI_COLOR_RED "clock_widget_create(): Could not cache glyphs (%d)." ANSI_COLOR_RESET "\n", err);
+        return clock;
+    }
+
+    widget = lv_mem_alloc(sizeof(Clock_Widget));
+    if (!widget) return clock;
+    memset(widget, 0, sizeof(Clock_Widget));
+
+    for (Clock_Slot slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        widget->slots[slot] = lv_img_create(clock);
+        lv_obj_set_style_img_recolor(widget->slots[slot], color, LV_PART_MAIN);
+        lv_obj_set_style_img_recolor_opa(widget->slots[slot], LV_OPA_COVER, LV_PART_MAIN);
+        lv_obj_add_flag(widget->slots[slot], LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_obj_set_size(clock, clock_width(), glyph_cache.height);
+
+    lv_obj_set_user_data(clock, widget);
+    lv_obj_add_event_cb(clock, clock_widget_delete_cb, LV_EVENT_DELETE, NULL);
+    return clock;
+}
+
+// Same as strftime("%I:%M %p"), hours 1-9 keep their leading zero
+void clock_widget_set_time(lv_obj_t* clock, const struct tm* time)
+{
+    Clock_Widget* widget = lv_obj_get_user_data(clock);
+    uint8_t hour = (time->tm_hour % 12) ? time->tm_hour % 12 : 12;
+    char text[SLOT_COUNT] = {
+        [SLOT_HOUR_TENS]    = '0' + hour / 10,
+        [SLOT_HOUR_ONES]    = '0' + hour % 10,
+        [SLOT_COLON]        = ':',
+        [SLOT_MINUTE_TENS]  = '0' + time->tm_min / 10,
+        [SLOT_MINUTE_ONES]  = '0' + time->tm_min % 10,
+        [SLOT_MERIDIEM]     = (time->tm_hour < 12) ? 'A' : 'P',
+        [SLOT_M]            = 'M',
+    };
+
+    if (!widget) return;
+
+    // Every slot has a fixed cell, only the characters that changed get redrawn
+    for (Clock_Slot slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        if (text[slot] != widget->shown[slot]) slot_show(widget, slot, text[slot]);
+    }
+}
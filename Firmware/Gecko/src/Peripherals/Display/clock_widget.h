@@ -0,0 +1,17 @@
+#ifndef __CLOCK_WIDGET__
+#define __CLOCK_WIDGET__
+
+#include <time.h>
+#include <lvgl.h>
+
+/*
+    Clock widget
+    Shows the time as "hh:mm AM" from glyph bitmaps rasterised once at start up, each character
+    is its own image so a minute tick only redraws the digits that actually changed.
+*/
+
+// Every clock shares one glyph cache, so they all have to use the same font
+lv_obj_t* clock_widget_create(lv_obj_t* parent, const lv_font_t* font, lv_color_t color);
+void clock_widget_set_time(lv_obj_t* clock, const struct tm* time);
+
+#endif // __CLOCK_WIDGET__
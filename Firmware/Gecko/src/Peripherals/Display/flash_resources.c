@@ -0,0 +1,479 @@
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <lvgl.h>
+
+#include "console.h"
+#include "Peripherals/ExternalFlash/externalFlash.h"
+#include "flash_resources.h"
+#include "asset_decoder.h"
+
+#define RESOURCES_HEADER_SIZE   16
+#define RESOURCES_ENTRY_SIZE    32
+#define RESOURCES_NAME_LENGTH   24
+
+#define FONT_HEADER_SIZE        32
+#define FONT_GLYPH_SIZE         16
+#define FONT_VERSION            1
+#define FONTS_MAX               4
+
+#define BLOCK_SIZE              256 // One NOR page, reading all of it costs little more than a few bytes
+#define BLOCK_COUNT             8
+#define BLOCK_EMPTY             UINT32_MAX
+
+#define GLYPH_SLOTS             24
+#define GLYPH_SLOT_BYTES        256 // Any 4 bpp glyph up to ~22x22 px, bigger ones are read every time
+#define GLYPH_MAX_BYTES         2048
+
+typedef struct {
+    uint32_t block;     // Address / BLOCK_SIZE
+    uint32_t last_used;
+    uint8_t data[BLOCK_SIZE];
+} Flash_Block;
+
+typedef struct {
+    uint32_t address;   // Absolute, in the external flash
+    uint32_t size;
+} Flash_Entry;
+
+typedef struct {
+    Flash_Entry entry;
+    uint32_t pos;
+} Flash_File;
+
+typedef struct {
+    uint32_t unicode;
+    uint32_t bitmap_offset;
+    uint16_t adv_w;     // 1/16 px
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint8_t left_class;
+    uint8_t right_class;
+} Flash_Glyph;
+
+typedef struct {
+    char name[RESOURCES_NAME_LENGTH];
+    uint8_t bpp;
+    uint16_t glyph_count;
+    uint8_t kern_left_classes;
+    uint8_t kern_right_classes;
+    uint16_t kern_scale;
+    uint32_t glyphs_address;
+    uint32_t kern_address;
+    uint32_t bitmaps_address;
+    lv_font_t font;
+} Flash_Font;
+
+typedef struct {
+    const Flash_Font* font; // NULL while the slot is empty
+    bool found;             // Negative lookups are cached too, LVGL asks for missing glyphs repeatedly
+    Flash_Glyph glyph;
+    uint32_t last_used;
+    uint8_t bitmap[GLYPH_SLOT_BYTES];
+} Flash_Glyph_Slot;
+
+static bool resources_mounted;
+static uint16_t resources_count;
+static lv_fs_drv_t resources_drv;
+
+static Flash_Block blocks[BLOCK_COUNT];
+static Flash_Glyph_Slot glyph_slots[GLYPH_SLOTS];
+static uint8_t glyph_oversize[GLYPH_MAX_BYTES]; // Valid until the next oversized glyph is read
+static uint32_t cache_clock;
+
+static Flash_Font fonts[FONTS_MAX];
+static uint8_t fonts_loaded;
+
+static Flash_Resource_Stats stats;
+
+static inline uint16_t get_le16(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8);
+}
+
+static inline uint32_t get_le32(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static int spi_read(uint32_t address, void* data, uint32_t length)
+{
+    stats.spi_reads++;
+    stats.spi_bytes += length;
+    return externalFlashRead(address, data, length);
+}
+
+// Least recently used block is replaced on a miss
+static const uint8_t* block_get(uint32_t block)
+{
+    Flash_Block* victim = &blocks[0];
+
+    for (uint8_t i = 0; i < BLOCK_COUNT; i++)
+    {
+        if (blocks[i].block == block)
+        {
+            stats.block_hits++;
+            blocks[i].last_used = ++cache_clock;
+            return blocks[i].data;
+        }
+        if (blocks[i].last_used < victim->last_used) victim = &blocks[i];
+    }
+
+    stats.block_misses++;
+    if (spi_read(block * BLOCK_SIZE, victim->data, BLOCK_SIZE))
+    {
+        victim->block = BLOCK_EMPTY;
+        return NULL;
+    }
+    victim->block = block;
+    victim->last_used = ++cache_clock;
+    return victim->data;
+}
+
+// Small reads (tables, glyphs, image rows) go through the block cache, anything a block or longer
+//  is streamed straight from the flash so it doesn't flush everything else out of the cache
+static int flash_read(uint32_t address, void* data, uint32_t length)
+{
+    uint8_t* out = data;
+
+    if (length >= BLOCK_SIZE) return spi_read(address, data, length);
+
+    while (length)
+    {
+        const uint8_t* block = block_get(address / BLOCK_SIZE);
+        uint32_t offset = address % BLOCK_SIZE;
+        uint32_t chunk = LV_MIN(length, BLOCK_SIZE - offset);
+
+        if (!block) return -EIO;
+        memcpy(out, block + offset, chunk);
+        out += chunk;
+        address += chunk;
+        length -= chunk;
+    }
+    return 0;
+}
+
+static bool entry_find(const char* name, Flash_Entry* entry)
+{
+    uint8_t raw[RESOURCES_ENTRY_SIZE];
+
+    if (!resources_mounted) return false;
+
+    for (uint16_t i = 0; i < resources_count; i++)
+    {
+        if (flash_read(FLASH_RESOURCES_ADDRESS + RESOURCES_HEADER_SIZE + i * RESOURCES_ENTRY_SIZE, raw, sizeof(raw))) return false;
+        if (strncmp((const char*)raw, name, RESOURCES_NAME_LENGTH)) continue;
+
+        entry->address = FLASH_RESOURCES_ADDRESS + get_le32(&raw[RESOURCES_NAME_LENGTH]);
+        entry->size = get_le32(&raw[RESOURCES_NAME_LENGTH + 4]);
+        return true;
+    }
+    return false;
+}
+
+/* LVGL file system driver, read only */
+
+static void* fs_open(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode)
+{
+    Flash_File* file;
+    Flash_Entry entry;
+
+    if (mode != LV_FS_MODE_RD) return NULL;
+    if (*path == '/') path++;
+    if (!entry_find(path, &entry)) return NULL;
+
+    file = lv_mem_alloc(sizeof(Flash_File));
+    if (!file) return NULL;
+    file->entry = entry;
+    file->pos = 0;
+    return file;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p)
+{
+    lv_mem_free(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br)
+{
+    Flash_File* file = file_p;
+
+    btr = LV_MIN(btr, file->entry.size - file->pos);
+    if (flash_read(file->entry.address + file->pos, buf, btr)) return LV_FS_RES_HW_ERR;
+    file->pos += btr;
+    *br = btr;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    Flash_File* file = file_p;
+
+    switch (whence)
+    {
+        case LV_FS_SEEK_SET:
+            break;
+        case LV_FS_SEEK_CUR:
+            pos += file->pos;
+            break;
+        case LV_FS_SEEK_END:
+            pos += file->entry.size;
+            break;
+    }
+    file->pos = LV_MIN(pos, file->entry.size);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p)
+{
+    *pos_p = ((Flash_File*)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+/* Fonts */
+
+static uint32_t glyph_bitmap_bytes(const Flash_Font* font, const Flash_Glyph* glyph)
+{
+    return (glyph->box_w * glyph->box_h * font->bpp + 7) / 8;
+}
+
+// Binary search of the glyph table, it is sorted by code point
+static bool glyph_find(const Flash_Font* font, uint32_t unicode, Flash_Glyph* glyph)
+{
+    uint8_t raw[FONT_GLYPH_SIZE];
+    int32_t low = 0;
+    int32_t high = font->glyph_count - 1;
+
+    while (low <= high)
+    {
+        int32_t mid = (low + high) / 2;
+        uint32_t mid_unicode;
+
+        if (flash_read(font->glyphs_address + mid * FONT_GLYPH_SIZE, raw, sizeof(raw))) return false;
+        mid_unicode = get_le32(raw);
+        if (mid_unicode < unicode) low = mid + 1;
+        else if (mid_unicode > unicode) high = mid - 1;
+        else
+        {
+            glyph->unicode = unicode;
+            glyph->bitmap_offset = get_le32(&raw[4]);
+            glyph->adv_w = get_le16(&raw[8]);
+            glyph->box_w = raw[10];
+            glyph->box_h = raw[11];
+            glyph->ofs_x = (int8_t)raw[12];
+            glyph->ofs_y = (int8_t)raw[13];
+            glyph->left_class = raw[14];
+            glyph->right_class = raw[15];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Glyph and its bitmap out of the LRU cache, loaded from flash on a miss. NULL if the font lacks it
+static const Flash_Glyph_Slot* glyph_get(const Flash_Font* font, uint32_t unicode)
+{
+    Flash_Glyph_Slot* victim = &glyph_slots[0];
+    uint32_t bytes;
+
+    for (uint8_t i = 0; i < GLYPH_SLOTS; i++)
+    {
+        Flash_Glyph_Slot* slot = &glyph_slots[i];
+
+        if (slot->font == font && slot->glyph.unicode == unicode)
+        {
+            stats.glyph_hits++;
+            slot->last_used = ++cache_clock;
+            return slot->found ? slot : NULL;
+        }
+        if (slot->last_used < victim->last_used) victim = slot;
+    }
+
+    stats.glyph_misses++;
+    victim->font = font;
+    victim->glyph.unicode = unicode;
+    victim->last_used = ++cache_clock;
+    victim->found = glyph_find(font, unicode, &victim->glyph);
+    if (!victim->found) return NULL;
+
+    bytes = glyph_bitmap_bytes(font, &victim->glyph);
+    if (bytes && bytes <= GLYPH_SLOT_BYTES &&
+        flash_read(font->bitmaps_address + victim->glyph.bitmap_offset, victim->bitmap, bytes))
+    {
+        victim->font = NULL; // Try again next time rather than caching a bad read
+        return NULL;
+    }
+    return victim;
+}
+
+// Class based kerning, in 1/16 px like adv_w
+static int32_t font_kern(const Flash_Font* font, const Flash_Glyph* left, uint32_t unicode_next)
+{
+    const Flash_Glyph_Slot* right;
+    int8_t value;
+
+    if (!unicode_next || !font->kern_left_classes || !left->left_class) return 0;
+
+    right = glyph_get(font, unicode_next);
+    if (!right || !right->glyph.right_class) return 0;
+
+    if (flash_read(font->kern_address + (left->left_class - 1) * font->kern_right_classes + right->glyph.right_class - 1, &value, 1)) return 0;
+    return (value * font->kern_scale) >> 4;
+}
+
+static bool font_get_glyph_dsc(const lv_font_t* lv_font, lv_font_glyph_dsc_t* dsc, uint32_t unicode, uint32_t unicode_next)
+{
+    const Flash_Font* font = lv_font->dsc;
+    const Flash_Glyph_Slot* slot = glyph_get(font, unicode);
+    Flash_Glyph glyph;
+    int32_t adv_w;
+
+    if (!slot) return false;
+
+    // Looking up the next glyph for kerning can evict this one
+    glyph = slot->glyph;
+    adv_w = glyph.adv_w + font_kern(font, &glyph, unicode_next);
+
+    dsc->adv_w = (adv_w + 8) >> 4;
+    dsc->box_w = glyph.box_w;
+    dsc->box_h = glyph.box_h;
+    dsc->ofs_x = glyph.ofs_x;
+    dsc->ofs_y = glyph.ofs_y;
+    dsc->bpp = font->bpp;
+    dsc->is_placeholder = false;
+    return true;
+}
+
+// LVGL draws the bitmap straight after asking for it, so pointing into the cache is safe
+static const uint8_t* font_get_glyph_bitmap(const lv_font_t* lv_font, uint32_t unicode)
+{
+    const Flash_Font* font = lv_font->dsc;
+    const Flash_Glyph_Slot* slot = glyph_get(font, unicode);
+    uint32_t bytes;
+
+    if (!slot) return NULL;
+
+    bytes = glyph_bitmap_bytes(font, &slot->glyph);
+    if (bytes <= GLYPH_SLOT_BYTES) return slot->bitmap;
+    if (bytes > GLYPH_MAX_BYTES) return NULL;
+    if (flash_read(font->bitmaps_address + slot->glyph.bitmap_offset, glyph_oversize, bytes)) return NULL;
+    return glyph_oversize;
+}
+
+static bool font_load(Flash_Font* font, const char* name, const lv_font_t* fallback)
+{
+    Flash_Entry entry;
+    uint8_t raw[FONT_HEADER_SIZE];
+
+    if (!entry_find(name, &entry) || entry.size < FONT_HEADER_SIZE) return false;
+    if (flash_read(entry.address, raw, sizeof(raw))) return false;
+    if (memcmp(raw, "GFNT", 4) || raw[4] != FONT_VERSION) return false;
+
+    memset(font, 0, sizeof(Flash_Font));
+    strncpy(font->name, name, RESOURCES_NAME_LENGTH - 1);
+    font->bpp = raw[5];
+    font->glyph_count = get_le16(&raw[6]);
+    font->kern_left_classes = raw[14];
+    font->kern_right_classes = raw[15];
+    font->kern_scale = get_le16(&raw[16]);
+    font->glyphs_address = entry.address + get_le32(&raw[20]);
+    font->kern_address = entry.address + get_le32(&raw[24]);
+    font->bitmaps_address = entry.address + get_le32(&raw[28]);
+
+    font->font.get_glyph_dsc = font_get_glyph_dsc;
+    font->font.get_glyph_bitmap = font_get_glyph_bitmap;
+    font->font.line_height = (int16_t)get_le16(&raw[8]);
+    font->font.base_line = (int16_t)get_le16(&raw[10]);
+    font->font.subpx = LV_FONT_SUBPX_NONE;
+    font->font.underline_position = (int8_t)raw[12];
+    font->font.underline_thickness = raw[13];
+    font->font.dsc = font;
+    font->font.fallback = fallback; // Characters the packed font doesn't have still show up
+    return true;
+}
+
+/* Public */
+
+// Mount the resource image, if the flash is blank or holds something else the fallbacks are used
+bool flash_resources_init(void)
+{
+    uint8_t header[RESOURCES_HEADER_SIZE];
+
+    printf("Init Flash Resources...");
+
+    for (uint8_t i = 0; i < BLOCK_COUNT; i++) blocks[i].block = BLOCK_EMPTY;
+
+    if (flash_read(FLASH_RESOURCES_ADDRESS, header, sizeof(header)))
+    {
+        printf(ANSI_COLOR_RED "ERR" ANSI_COLOR_RESET "\n");
+        return false;
+    }
+    if (memcmp(header, "GRES", 4) || get_le16(&header[4]) != FLASH_RESOURCES_VERSION)
+    {
+        printf(ANSI_COLOR_YELLOW "NONE" ANSI_COLOR_RESET "\n");
+        return false;
+    }
+
+    resources_count = get_le16(&header[6]);
+    resources_mounted = true;
+
+    lv_fs_drv_init(&resources_drv);
+    resources_drv.letter = FLASH_RESOURCES_LETTER;
+    resources_drv.cache_size = 0; // Our block cache already sits under every read
+    resources_drv.open_cb = fs_open;
+    resources_drv.close_cb = fs_close;
+    resources_drv.read_cb = fs_read;
+    resources_drv.seek_cb = fs_seek;
+    resources_drv.tell_cb = fs_tell;
+    lv_fs_drv_register(&resources_drv);
+
+    printf(ANSI_COLOR_GREEN "OK" ANSI_COLOR_RESET " (%u files, %u bytes)\n", resources_count, get_le32(&header[8]));
+    return true;
+}
+
+// Image source for a packed image, the returned path is only good until the next call (lv_img_set_src() copies it)
+const void* flash_resources_image(const char* name, const void* fallback)
+{
+    static char path[RESOURCES_NAME_LENGTH + 2];
+    Flash_Entry entry;
+
+    if (!entry_find(name, &entry)) return fallback;
+
+    snprintf(path, sizeof(path), "%c:%s", FLASH_RESOURCES_LETTER, name);
+    return path;
+}
+
+// A packed font, loaded on first use. Fonts are never unloaded, the glyph cache is shared by all of them
+const lv_font_t* flash_resources_font(const char* name, const lv_font_t* fallback)
+{
+    for (uint8_t i = 0; i < fonts_loaded; i++)
+    {
+        if (!strncmp(fonts[i].name, name, RESOURCES_NAME_LENGTH)) return &fonts[i].font;
+    }
+
+    if (fonts_loaded == FONTS_MAX || !font_load(&fonts[fonts_loaded], name, fallback)) return fallback;
+    return &fonts[fonts_loaded++].font;
+}
+
+void flash_resources_get_stats(Flash_Resource_Stats* out)
+{
+    *out = stats;
+    asset_decoder_get_line_stats(&out->line_hits, &out->line_misses);
+}
+
+void flash_resources_print_report(void)
+{
+    Flash_Resource_Stats s;
+
+    if (!resources_mounted) return;
+
+    flash_resources_get_stats(&s);
+    printf("Flash resources: %u SPI reads (%u bytes), hits: blocks %u/%u, glyphs %u/%u, lines %u/%u\n",
+        s.spi_reads, s.spi_bytes,
+        s.block_hits, s.block_hits + s.block_misses,
+        s.glyph_hits, s.glyph_hits + s.glyph_misses,
+        s.line_hits, s.line_hits + s.line_misses);
+}
@@ -0,0 +1,64 @@
+#ifndef __FLASH_RESOURCES__
+#define __FLASH_RESOURCES__
+
+#include <lvgl.h>
+
+/*
+    Fonts and images kept on the external NOR flash instead of being linked into internal flash.
+    The resource image is built by Software Tools/Resource Packer and programmed at
+    FLASH_RESOURCES_ADDRESS, its files are mounted as LVGL drive 'F' so images are used as
+    "F:name" sources. Fonts are streamed glyph by glyph rather than loaded with lv_font_load(),
+    which would copy the whole font into the LVGL heap.
+
+    Every SPI read goes through a small LRU cache of flash blocks, and glyph bitmaps have their
+    own LRU cache so a redraw of the same text does not touch the flash at all.
+
+    Image layout, little endian:
+        char     magic[4]           "GRES"
+        uint16_t version            FLASH_RESOURCES_VERSION
+        uint16_t count              Number of files
+        uint32_t size               Whole image, header included
+        uint32_t reserved
+        entries[count]              char name[24] (NUL padded), uint32_t offset, uint32_t size
+
+    Font files ("GFNT"), offsets relative to the start of the file:
+        char     magic[4]           "GFNT"
+        uint8_t  version, bpp
+        uint16_t glyph_count
+        int16_t  line_height, base_line
+        int8_t   underline_position
+        uint8_t  underline_thickness
+        uint8_t  kern_left_classes, kern_right_classes
+        uint16_t kern_scale         As lv_font_fmt_txt_dsc_t, 16 = 1.0
+        uint16_t reserved
+        uint32_t glyphs_offset, kern_offset, bitmaps_offset
+        glyphs[glyph_count]         Sorted by code point: uint32_t unicode, uint32_t bitmap_offset,
+                                    uint16_t adv_w (1/16 px), uint8_t box_w, box_h,
+                                    int8_t ofs_x, ofs_y, uint8_t left_class, right_class
+        int8_t   kern[left_classes * right_classes]
+        uint8_t  bitmaps[]          lv_font_fmt_txt plain bitmaps
+*/
+
+#define FLASH_RESOURCES_ADDRESS     0x000000
+#define FLASH_RESOURCES_VERSION     1
+#define FLASH_RESOURCES_LETTER      'F'
+
+// Cache hit rates and how much the SPI bus actually moved
+typedef struct {
+    uint32_t block_hits;
+    uint32_t block_misses;
+    uint32_t glyph_hits;
+    uint32_t glyph_misses;
+    uint32_t line_hits;     // Decoded image lines, see asset_decoder.c
+    uint32_t line_misses;
+    uint32_t spi_reads;
+    uint32_t spi_bytes;
+} Flash_Resource_Stats;
+
+bool flash_resources_init(void);
+const void* flash_resources_image(const char* name, const void* fallback);
+const lv_font_t* flash_resources_font(const char* name, const lv_font_t* fallback);
+void flash_resources_get_stats(Flash_Resource_Stats* stats);
+void flash_resources_print_report(void);
+
+#endif // __FLASH_RESOURCES__
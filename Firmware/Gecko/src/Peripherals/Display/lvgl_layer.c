@@ -1,16 +1,23 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/display.h>
+#include <zephyr/sys/atomic.h>
 #include <lvgl.h>
 
 #include "Peripherals/BMA400/taps.h" 
 #include "clock.h"
+#include "trace.h"
 #include "Peripherals/Power/battery.h"
 #include "BLE/BLE.h"
 #include "system.h"
 #include "lvgl_layer.h"
 #include "assets.h"
+#include "gc9a01.h"
+#include "clock_widget.h"
+#include "asset_decoder.h"
+#include "flash_resources.h"
 
 // Zephyr display object
 const struct device* display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
@@ -22,18 +29,103 @@ static Notification_Detailed_Screen detailedNotificationScreenObj;
 static Device_Status_Screen deviceScreenObj;
 static Device_Brightness_Screen deviceBrightnessScreenObj;
 static Charging_Screen chargingScreenObj;
+static Always_On_Screen alwaysOnScreenObj;
 
 static Screen_Type active_screen;
 static bool screen_initialized = false;
 static uint8_t active_brightness = DISPLAY_START_BRIGHTNESS; // Display API does not have a get function, this brightness is what is actually set
 
+// Animations only look right when frames are paced off the panel's TE line, without it they stay off
+static bool display_has_vsync = false;
+static lv_anim_enable_t roller_anim = LV_ANIM_OFF;
+// Vsync is only passed on to the main loop while something is animating
+static atomic_t vsync_armed = ATOMIC_INIT(0);
+
+// What is drawn when the external flash has no resource image, CONFIG_GECKO_BUILTIN_ASSETS
+#ifdef CONFIG_GECKO_BUILTIN_ASSETS
+LV_IMG_DECLARE(img_sloth_desc);
+#define FALLBACK_CLOCK_FONT         (&lv_font_montserrat_24)
+#define FALLBACK_SCREEN_SAVER       ((const void*) &img_sloth_desc)
+#else
+#define FALLBACK_CLOCK_FONT         LV_FONT_DEFAULT
+#define FALLBACK_SCREEN_SAVER       NULL
+#endif
+
+#define DETAILED_BODY_TOP_ROW       96  // Everything above (app name, title) stays put
+#define DETAILED_BODY_WIDTH         200 // 200 seems like an ok number, probably still room to tweak
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+// Detailed notification bodies that don't fit are scrolled by the panel itself (hardware vertical
+//  scroll), LVGL only has to draw the rows that come into view
+#define DETAILED_SCROLL_STEP_ROWS   6   // Rows moved per step of the scroll animation
+#define DETAILED_SCROLL_PAGE_ROWS   72  // Rows moved per tap
+#define DETAILED_SCROLL_PERIOD_MS   20
+
+static bool detailed_scroll_active = false;
+static uint16_t detailed_scroll_offset;
+static lv_coord_t detailed_scroll_pending; // Rows left to move for the current tap
+static lv_timer_t* detailed_scroll_timer;
+#endif
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+// Or page through them: line breaks are worked out once per notification and only the lines of
+//  the current page are ever given to the label, so a tap costs one page whatever the length
+#define DETAILED_PAGE_LINES         5   // What fits above the round bottom edge
+#define DETAILED_MAX_LINES          64  // Per body, anything further is cut off
+
+typedef struct {
+    uint32_t id;            // Notification the breaks belong to, 0 while unused
+    uint32_t last_used;
+    uint16_t line_count;
+    uint16_t line_starts[DETAILED_MAX_LINES + 1]; // Byte offset of each line, then the end of the last one
+} Body_Layout;
+
+static Body_Layout body_layouts[MAX_NOTIFICATION_COUNT];
+static uint32_t body_layout_clock;
+static uint32_t detailed_body_id;   // What the body shows, 0 for the "NONE" placeholder
+static uint16_t detailed_page;
+static char detailed_page_text[DETAILED_PAGE_LINES * 80];
+#endif
+
+// Rarely used screens are deleted after going unused this long
+#define SCREEN_TEARDOWN_IDLE_MS     3000
+static lv_timer_t* screen_teardown_timer;
+
+// Refresh governor, LVGL is only woken for real work: the refresh timer is parked while nothing is
+//  invalidated and sped up while something animates
+#define DISPLAY_BOOST_PERIOD_MS     16  // ~60 fps while animating
+
+static bool governor_awake = false;
+static uint32_t governor_awake_start;   // ms
+static uint32_t governor_wakeups;
+static uint64_t governor_lvgl_cycles;
+
 static char notification_roller_buffer[MAX_LENGTH_APP_NAME * (MAX_NOTIFICATION_COUNT + 1)]; // Extra notification for "Go Back" option
 
-static void init_display_objects(void)
+#define ROLLER_TAIL                 "[Exit Roller]\n[Clear All]\n"
+#define ROLLER_EMPTY                "No Current Messages\n"
+
+// Roller rows mirror the notification store (newest first) and are patched with add/remove deltas,
+//  notification_roller_buffer always holds the rows followed by ROLLER_TAIL
+typedef struct {
+    uint32_t ids[MAX_NOTIFICATION_COUNT];
+    uint8_t lengths[MAX_NOTIFICATION_COUNT];    // Bytes each row takes in the buffer, '\n' included
+    uint8_t count;
+    uint32_t revision;                          // notificationRevision the rows were last synced to
+} Roller_Model;
+
+static Roller_Model roller_model;
+
+/*
+    Screen construction
+    Screens are only built the first time they are shown. The ones that are rarely looked at are
+    deleted again once they've gone unused for a while (or the display sleeps), everything else
+    stays built since it's back on screen within a few taps.
+*/
+static void create_home_screen(void)
 {
-    /* 
-        Home Screen
-    */
+    const void* screen_saver;
+
     homeScreenObj.lvgl_object = lv_obj_create(NULL);
 
     // Create notification indicator objects (two circles to create circluar outline on display) but keep them hidden
@@ -52,28 +144,26 @@ static void init_display_objects(void)
     lv_obj_add_flag(homeScreenObj.notification_marker_outer, LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_flag(homeScreenObj.notification_marker_inner, LV_OBJ_FLAG_HIDDEN);
 
-    // Home screen saver image
-    LV_IMG_DECLARE(img_sloth_desc);
+    // Home screen saver image, left empty if there is neither a packed nor a built-in one
     homeScreenObj.screen_saver = lv_img_create(homeScreenObj.lvgl_object);
-    lv_img_set_src(homeScreenObj.screen_saver, &img_sloth_desc);
+    screen_saver = flash_resources_image("sloth.rle", FALLBACK_SCREEN_SAVER);
+    if (screen_saver) lv_img_set_src(homeScreenObj.screen_saver, screen_saver);
     lv_obj_align(homeScreenObj.screen_saver, LV_ALIGN_CENTER, 0, -25);
 
     // Current time label
-    homeScreenObj.time_label = lv_label_create(homeScreenObj.lvgl_object);
-    lv_obj_set_style_text_font(homeScreenObj.time_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_label_set_text(homeScreenObj.time_label, "??:?? PM");
-    lv_obj_set_style_text_align(homeScreenObj.time_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(homeScreenObj.time_label, LV_ALIGN_CENTER, 0, 50);
+    homeScreenObj.clock = clock_widget_create(homeScreenObj.lvgl_object, flash_resources_font("montserrat_24", FALLBACK_CLOCK_FONT),
+        lv_obj_get_style_text_color(homeScreenObj.lvgl_object, LV_PART_MAIN));
+    lv_obj_align(homeScreenObj.clock, LV_ALIGN_CENTER, 0, 50);
 
     // Battery percentage label
     homeScreenObj.battery_percent_label = lv_label_create(homeScreenObj.lvgl_object);
     lv_label_set_text(homeScreenObj.battery_percent_label, "??%");
     lv_obj_set_style_text_align(homeScreenObj.battery_percent_label, LV_TEXT_ALIGN_CENTER, 0);
     lv_obj_align(homeScreenObj.battery_percent_label, LV_ALIGN_CENTER, 0, 85);
+}
 
-    /* 
-        Notification Screen
-    */
+static void create_notification_summary_screen(void)
+{
     notificationScreenObj.roller_is_active = false;
     notificationScreenObj.lvgl_object = lv_obj_create(NULL);
 
@@ -96,15 +186,18 @@ static void init_display_objects(void)
     // Create the notification roller
     notificationScreenObj.roller = lv_roller_create(notificationScreenObj.lvgl_object);
     lv_obj_set_style_text_line_space(notificationScreenObj.lvgl_object, 23, LV_PART_MAIN);
-    lv_roller_set_options(notificationScreenObj.roller,
-        "???\n",
-        LV_ROLLER_MODE_INFINITE);
+    lv_roller_set_options(notificationScreenObj.roller, ROLLER_EMPTY, LV_ROLLER_MODE_INFINITE);
     lv_roller_set_visible_row_count(notificationScreenObj.roller, 5);
-    lv_obj_center(notificationScreenObj.roller);    
+    lv_obj_center(notificationScreenObj.roller);
+
+    // Empty, and out of date with the store so the first visit fills it in
+    memset(&roller_model, 0, sizeof(roller_model));
+    roller_model.revision = notificationRevision - 1;
+    strcpy(notification_roller_buffer, ROLLER_TAIL);
+}
 
-    /* 
-        Detailed Notification Screen
-    */
+static void create_notification_detailed_screen(void)
+{
     detailedNotificationScreenObj.lvgl_object = lv_obj_create(NULL);
     detailedNotificationScreenObj.app_label = lv_label_create(detailedNotificationScreenObj.lvgl_object);
     lv_label_set_text(detailedNotificationScreenObj.app_label, "Example App Name");
@@ -114,17 +207,45 @@ static void init_display_objects(void)
     lv_label_set_text(detailedNotificationScreenObj.message_title_label, "Example Msg Title | ?:?? PM");
     lv_obj_align(detailedNotificationScreenObj.message_title_label, LV_ALIGN_CENTER, 0, -45);
 
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    // The body box covers the hardware scroll area, full width so the whole rows scroll together
+    detailedNotificationScreenObj.message_body_box = lv_obj_create(detailedNotificationScreenObj.lvgl_object);
+    lv_obj_set_size(detailedNotificationScreenObj.message_body_box, 240, 240 - DETAILED_BODY_TOP_ROW);
+    lv_obj_align(detailedNotificationScreenObj.message_body_box, LV_ALIGN_TOP_LEFT, 0, DETAILED_BODY_TOP_ROW);
+    lv_obj_set_style_border_width(detailedNotificationScreenObj.message_body_box, 0, LV_PART_MAIN);
+    lv_obj_set_style_radius(detailedNotificationScreenObj.message_body_box, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(detailedNotificationScreenObj.message_body_box, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_bottom(detailedNotificationScreenObj.message_body_box, 48, LV_PART_MAIN); // Lets the last line scroll up clear of the round edge
+    lv_obj_set_scrollbar_mode(detailedNotificationScreenObj.message_body_box, LV_SCROLLBAR_MODE_OFF);
+
+    detailedNotificationScreenObj.message_body_label = lv_label_create(detailedNotificationScreenObj.message_body_box);
+#else
+    // A page always fits, the label sits straight on the screen
     detailedNotificationScreenObj.message_body_label = lv_label_create(detailedNotificationScreenObj.lvgl_object);
+#endif
     lv_label_set_long_mode(detailedNotificationScreenObj.message_body_label, LV_LABEL_LONG_WRAP);
     lv_label_set_text(detailedNotificationScreenObj.message_body_label, 
         "This is an example message body text. It can be quite long with line wrapping enabled.");
-    lv_obj_set_width(detailedNotificationScreenObj.message_body_label, 200); // 200 seems like an ok number, probably still room to tweak
+    lv_obj_set_width(detailedNotificationScreenObj.message_body_label, DETAILED_BODY_WIDTH);
     lv_obj_set_style_text_align(detailedNotificationScreenObj.message_body_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(detailedNotificationScreenObj.message_body_label, LV_ALIGN_CENTER, 0, 10);
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    lv_obj_align(detailedNotificationScreenObj.message_body_label, LV_ALIGN_TOP_MID, 0, 4);
+#else
+    lv_obj_align(detailedNotificationScreenObj.message_body_label, LV_ALIGN_TOP_MID, 0, DETAILED_BODY_TOP_ROW + 4);
+#endif
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+    // "2/3" under the body while it has more than one page
+    detailedNotificationScreenObj.message_page_label = lv_label_create(detailedNotificationScreenObj.lvgl_object);
+    lv_label_set_text(detailedNotificationScreenObj.message_page_label, "");
+    lv_obj_align(detailedNotificationScreenObj.message_page_label, LV_ALIGN_BOTTOM_MID, 0, -14);
+    lv_obj_add_flag(detailedNotificationScreenObj.message_page_label, LV_OBJ_FLAG_HIDDEN);
+    detailed_body_id = UINT32_MAX; // Nothing shown yet
+#endif
+}
 
-    /* 
-        Device Status Screen
-    */
+static void create_device_status_screen(void)
+{
     deviceScreenObj.lvgl_object = lv_obj_create(NULL);
     deviceScreenObj.voltage_label = lv_label_create(deviceScreenObj.lvgl_object);
     lv_label_set_text(deviceScreenObj.voltage_label, "Battery Voltage: ?.?? V");
@@ -137,27 +258,540 @@ static void init_display_objects(void)
     deviceScreenObj.bluetooth_label = lv_label_create(deviceScreenObj.lvgl_object);
     lv_label_set_text(deviceScreenObj.bluetooth_label, "Bluetooth Status: Unknown");
     lv_obj_align(deviceScreenObj.bluetooth_label, LV_ALIGN_CENTER, 0, 20);
+}
 
-    /* 
-        Device Brightness Screen
-    */
+static void create_device_brightness_screen(void)
+{
     deviceBrightnessScreenObj.lvgl_object = lv_obj_create(NULL);
     deviceBrightnessScreenObj.brightness_label = lv_label_create(deviceBrightnessScreenObj.lvgl_object);
     lv_label_set_text(deviceBrightnessScreenObj.brightness_label, "Brightness: ?? %");
     lv_obj_align(deviceBrightnessScreenObj.brightness_label, LV_ALIGN_CENTER, 0, 0);
+}
 
-    /* 
-        Charging Screen
-    */
+static void create_charging_screen(void)
+{
     chargingScreenObj.lvgl_object = lv_obj_create(NULL);
     chargingScreenObj.charging_label = lv_label_create(chargingScreenObj.lvgl_object);
     lv_label_set_text(chargingScreenObj.charging_label, "Charging... ?? % / ?.?? V");
     lv_obj_align(chargingScreenObj.charging_label, LV_ALIGN_CENTER, 0, 0);
 }
 
+static void create_always_on_screen(void)
+{
+    // White on black, it has to survive idle mode's 8 colors and only the middle band is lit
+    alwaysOnScreenObj.lvgl_object = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(alwaysOnScreenObj.lvgl_object, lv_color_hex(0x000000), LV_PART_MAIN);
+    alwaysOnScreenObj.clock = clock_widget_create(alwaysOnScreenObj.lvgl_object, flash_resources_font("montserrat_24", FALLBACK_CLOCK_FONT), lv_color_hex(0xFFFFFF));
+    lv_obj_align(alwaysOnScreenObj.clock, LV_ALIGN_CENTER, 0, (ALWAYS_ON_BAND_START_ROW + ALWAYS_ON_BAND_END_ROW + 1) / 2 - 120);
+}
+
+typedef struct {
+    lv_obj_t** lvgl_object; // Root object in the screen's struct, NULL while it isn't built
+    void* state;            // The whole struct, cleared on teardown so no stale children are left
+    size_t state_size;
+    void (*create)(void);
+    bool transient;         // Deleted once unused for SCREEN_TEARDOWN_IDLE_MS
+} Screen_Def;
+
+static const Screen_Def screen_defs[SCREEN_TYPE_COUNT] = {
+    [SCREEN_HOME]                   = { &homeScreenObj.lvgl_object, &homeScreenObj, sizeof(homeScreenObj), create_home_screen, false },
+    [SCREEN_NOTIFICATION_SUMMARY]   = { &notificationScreenObj.lvgl_object, &notificationScreenObj, sizeof(notificationScreenObj), create_notification_summary_screen, false },
+    [SCREEN_NOTIFICATION_DETAILED]  = { &detailedNotificationScreenObj.lvgl_object, &detailedNotificationScreenObj, sizeof(detailedNotificationScreenObj), create_notification_detailed_screen, false },
+    [SCREEN_DEVICE_STATUS]          = { &deviceScreenObj.lvgl_object, &deviceScreenObj, sizeof(deviceScreenObj), create_device_status_screen, true },
+    [SCREEN_DEVICE_BRIGHTNESS]      = { &deviceBrightnessScreenObj.lvgl_object, &deviceBrightnessScreenObj, sizeof(deviceBrightnessScreenObj), create_device_brightness_screen, true },
+    [SCREEN_CHARGING]               = { &chargingScreenObj.lvgl_object, &chargingScreenObj, sizeof(chargingScreenObj), create_charging_screen, true },
+    [SCREEN_ALWAYS_ON]              = { &alwaysOnScreenObj.lvgl_object, &alwaysOnScreenObj, sizeof(alwaysOnScreenObj), create_always_on_screen, false },
+};
+
+static const char* const screen_names[SCREEN_TYPE_COUNT] = {
+    [SCREEN_HOME]                   = "Home",
+    [SCREEN_NOTIFICATION_SUMMARY]   = "Notification Summary",
+    [SCREEN_NOTIFICATION_DETAILED]  = "Notification Detailed",
+    [SCREEN_DEVICE_STATUS]          = "Device Status",
+    [SCREEN_DEVICE_BRIGHTNESS]      = "Device Brightness",
+    [SCREEN_CHARGING]               = "Charging",
+    [SCREEN_ALWAYS_ON]              = "Always-on",
+};
+
+// LVGL heap each screen took the last time it was built
+static uint32_t screen_heap_bytes[SCREEN_TYPE_COUNT];
+
+// LVGL heap in use, only LVGL's own allocator (CONFIG_LV_MEM_CUSTOM=n) can tell us
+static uint32_t display_heap_used(void)
+{
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+// Get a screen's root object, building the screen first if it isn't already
+static lv_obj_t* screen_get(Screen_Type type)
+{
+    const Screen_Def* def = &screen_defs[type];
+    uint32_t used_before;
+
+    if (*def->lvgl_object) return *def->lvgl_object;
+
+    used_before = display_heap_used();
+    def->create();
+    screen_heap_bytes[type] = display_heap_used() - used_before;
+
+    return *def->lvgl_object;
+}
+
+// Delete every transient screen that isn't the one showing
+static void screens_teardown(void)
+{
+    for (Screen_Type type = 0; type < SCREEN_TYPE_COUNT; type++)
+    {
+        const Screen_Def* def = &screen_defs[type];
+
+        if (!def->transient || !*def->lvgl_object || type == active_screen) continue;
+        lv_obj_del(*def->lvgl_object);
+        memset(def->state, 0, def->state_size);
+    }
+}
+
+static void screen_teardown_timer_cb(lv_timer_t* timer)
+{
+    screens_teardown();
+    lv_timer_pause(timer);
+}
+
+void display_get_heap_stats(Display_Heap_Stats* stats)
+{
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    stats->total = mon.total_size;
+    stats->used = mon.total_size - mon.free_size;
+    stats->max_used = mon.max_used;
+    memcpy(stats->screen_bytes, screen_heap_bytes, sizeof(stats->screen_bytes));
+}
+
+void display_print_heap_report(void)
+{
+    Display_Heap_Stats stats;
+
+    display_get_heap_stats(&stats);
+    printf("LVGL heap: %u / %u bytes used, high-water %u bytes\n", stats.used, stats.total, stats.max_used);
+    for (Screen_Type type = 0; type < SCREEN_TYPE_COUNT; type++)
+    {
+        if (!screen_names[type]) continue;
+        if (stats.screen_bytes[type]) printf("  %-22s %6u bytes%s\n", screen_names[type], stats.screen_bytes[type], *screen_defs[type].lvgl_object ? "" : " (torn down)");
+        else printf("  %-22s not built yet\n", screen_names[type]);
+    }
+}
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+// Move the body up by rows using the panel's hardware scroll. LVGL's copy of the screen is scrolled
+//  with invalidation off so it doesn't redraw the whole box, then only the strip that came into
+//  view at the bottom is invalidated and drawn. Returns the rows actually moved.
+static lv_coord_t detailed_scroll_rows(lv_coord_t rows)
+{
+    lv_disp_t* disp = lv_disp_get_default();
+    lv_obj_t* box = detailedNotificationScreenObj.message_body_box;
+    lv_area_t exposed;
+
+    rows = LV_MIN(rows, lv_obj_get_scroll_bottom(box));
+    if (rows <= 0) return 0;
+
+    lv_disp_enable_invalidation(disp, false);
+    lv_obj_scroll_by(box, 0, -rows, LV_ANIM_OFF);
+    lv_disp_enable_invalidation(disp, true);
+
+    detailed_scroll_offset = (detailed_scroll_offset + rows) % (240 - DETAILED_BODY_TOP_ROW);
+    gc9a01_scroll_to(display_dev, detailed_scroll_offset);
+
+    exposed.x1 = 0;
+    exposed.x2 = 239;
+    exposed.y1 = 240 - rows;
+    exposed.y2 = 239;
+    _lv_inv_area(disp, &exposed);
+    lv_refr_now(disp);
+
+    return rows;
+}
+
+static void detailed_scroll_timer_cb(lv_timer_t* timer)
+{
+    lv_coord_t moved = detailed_scroll_rows(LV_MIN(detailed_scroll_pending, DETAILED_SCROLL_STEP_ROWS));
+
+    detailed_scroll_pending -= moved;
+    if (moved == 0 || detailed_scroll_pending <= 0) lv_timer_pause(timer);
+}
+
+// Start scrolling the body a page further, false if it is already showing the end
+static bool detailed_scroll_page(void)
+{
+    if (!detailed_scroll_active || lv_obj_get_scroll_bottom(detailedNotificationScreenObj.message_body_box) <= 0) return false;
+
+    detailed_scroll_pending = DETAILED_SCROLL_PAGE_ROWS;
+    lv_timer_resume(detailed_scroll_timer);
+    return true;
+}
+
+// Hardware scroll is only set up while a detailed notification too long for the screen is shown
+static void detailed_scroll_enable(bool enable)
+{
+    lv_timer_pause(detailed_scroll_timer);
+    detailed_scroll_pending = 0;
+    detailed_scroll_offset = 0;
+
+    if (enable == detailed_scroll_active) 
+    {
+        if (enable) gc9a01_scroll_to(display_dev, 0);
+        return;
+    }
+
+    if (enable) gc9a01_scroll_area_set(display_dev, DETAILED_BODY_TOP_ROW, 240 - DETAILED_BODY_TOP_ROW);
+    else gc9a01_scroll_area_set(display_dev, 0, 0);
+    detailed_scroll_active = enable;
+}
+#endif
+
+/*
+    View model
+    LVGL setters invalidate their widget whether or not anything changed (hiding an already hidden
+    full screen marker redraws the whole screen), so every screen update goes through these.
+    Each widget's last rendered value is checked first and LVGL is only called on a real change.
+*/
+static void view_set_text(lv_obj_t* label, const char* text)
+{
+    if (strcmp(lv_label_get_text(label), text) == 0) return;
+    lv_label_set_text(label, text);
+}
+
+static void view_set_hidden(lv_obj_t* obj, bool hidden)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden) return;
+    if (hidden) lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Loading the screen that is already up would still redraw all of it
+static void view_load_screen(lv_obj_t* screen)
+{
+    if (lv_scr_act() == screen) return;
+    lv_scr_load(screen);
+}
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+// Line breaks of a notification's body, worked out the first time it is opened and kept while it
+//  is in the store (least recently opened goes when a new one needs the space)
+static const Body_Layout* body_layout_get(const Notification* notification)
+{
+    lv_obj_t* label = detailedNotificationScreenObj.message_body_label;
+    const lv_font_t* font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(label, LV_PART_MAIN);
+    Body_Layout* layout = &body_layouts[0];
+    uint32_t pos = 0;
+
+    for (uint8_t i = 0; i < MAX_NOTIFICATION_COUNT; i++)
+    {
+        if (body_layouts[i].id == notification->id)
+        {
+            body_layouts[i].last_used = ++body_layout_clock;
+            return &body_layouts[i];
+        }
+        if (body_layouts[i].last_used < layout->last_used) layout = &body_layouts[i];
+    }
+
+    layout->id = notification->id;
+    layout->last_used = ++body_layout_clock;
+    layout->line_count = 0;
+    while (notification->text[pos] && layout->line_count < DETAILED_MAX_LINES)
+    {
+        uint32_t len = _lv_txt_get_next_line(&notification->text[pos], font, letter_space, DETAILED_BODY_WIDTH, NULL, LV_TEXT_FLAG_NONE);
+
+        if (len == 0) break;
+        layout->line_starts[layout->line_count++] = pos;
+        pos += len;
+    }
+    layout->line_starts[layout->line_count] = pos;
+    return layout;
+}
+
+static uint16_t body_page_count(const Body_Layout* layout)
+{
+    return LV_MAX(1, (layout->line_count + DETAILED_PAGE_LINES - 1) / DETAILED_PAGE_LINES);
+}
+
+// Give the label just the lines of one page, each already known to fit so LVGL has nothing to wrap
+static void body_page_show(const Notification* notification, const Body_Layout* layout, uint16_t page)
+{
+    uint16_t first = page * DETAILED_PAGE_LINES;
+    uint16_t last = LV_MIN(first + DETAILED_PAGE_LINES, layout->line_count);
+    uint16_t pages = body_page_count(layout);
+    size_t used = 0;
+    char counter[12];
+
+    for (uint16_t line = first; line < last; line++)
+    {
+        uint16_t start = layout->line_starts[line];
+        uint16_t end = layout->line_starts[line + 1];
+
+        while (end > start && (notification->text[end - 1] == ' ' || notification->text[end - 1] == '\n')) end--;
+        end = LV_MIN(end, start + sizeof(detailed_page_text) - used - 2);
+        memcpy(&detailed_page_text[used], &notification->text[start], end - start);
+        used += end - start;
+        if (line + 1 < last) detailed_page_text[used++] = '\n';
+    }
+    detailed_page_text[used] = '\0';
+    view_set_text(detailedNotificationScreenObj.message_body_label, detailed_page_text);
+
+    snprintf(counter, sizeof(counter), "%u/%u", page + 1, pages);
+    view_set_text(detailedNotificationScreenObj.message_page_label, counter);
+    view_set_hidden(detailedNotificationScreenObj.message_page_label, pages < 2);
+}
+
+// Show a notification's body from its first page, or keep the page if it is already the one showing
+static void detailed_body_set(const Notification* notification, bool restart)
+{
+    if (!notification)
+    {
+        detailed_body_id = 0;
+        view_set_text(detailedNotificationScreenObj.message_body_label, "NONE");
+        view_set_hidden(detailedNotificationScreenObj.message_page_label, true);
+        return;
+    }
+
+    if (restart || notification->id != detailed_body_id) detailed_page = 0;
+    detailed_body_id = notification->id;
+    body_page_show(notification, body_layout_get(notification), detailed_page);
+}
+
+// Move to the next page of the body, false if the last one is already showing
+static bool detailed_page_next(void)
+{
+    int8_t index = findNotification(detailed_body_id);
+    const Body_Layout* layout;
+
+    if (detailed_body_id == 0 || index < 0) return false;
+
+    layout = body_layout_get(&activeNotifications[index]);
+    if (detailed_page + 1 >= body_page_count(layout)) return false;
+
+    body_page_show(&activeNotifications[index], layout, ++detailed_page);
+    return true;
+}
+#endif
+
+/*
+    Notification roller model
+    The roller only takes its options as one string, so the string is edited in place row by row
+    and handed to LVGL only when a sync actually changed something. Entering the summary screen
+    with nothing new costs a revision compare.
+*/
+static uint16_t roller_row_offset(uint8_t row)
+{
+    uint16_t offset = 0;
+
+    for (uint8_t i = 0; i < row; i++) offset += roller_model.lengths[i];
+    return offset;
+}
+
+static void roller_row_insert(uint8_t row, const Notification* notification)
+{
+    uint16_t offset = roller_row_offset(row);
+    uint16_t end = roller_row_offset(roller_model.count) + sizeof(ROLLER_TAIL); // Tail and its terminator
+    uint8_t len = strnlen(notification->appName, MAX_LENGTH_APP_NAME - 1);
+
+    memmove(&notification_roller_buffer[offset + len + 1], &notification_roller_buffer[offset], end - offset);
+    memcpy(&notification_roller_buffer[offset], notification->appName, len);
+    notification_roller_buffer[offset + len] = '\n';
+
+    memmove(&roller_model.ids[row + 1], &roller_model.ids[row], (roller_model.count - row) * sizeof(roller_model.ids[0]));
+    memmove(&roller_model.lengths[row + 1], &roller_model.lengths[row], roller_model.count - row);
+    roller_model.ids[row] = notification->id;
+    roller_model.lengths[row] = len + 1;
+    roller_model.count++;
+}
+
+static void roller_row_remove(uint8_t row)
+{
+    uint16_t offset = roller_row_offset(row);
+    uint16_t end = roller_row_offset(roller_model.count) + sizeof(ROLLER_TAIL);
+    uint8_t len = roller_model.lengths[row];
+
+    memmove(&notification_roller_buffer[offset], &notification_roller_buffer[offset + len], end - offset - len);
+
+    roller_model.count--;
+    memmove(&roller_model.ids[row], &roller_model.ids[row + 1], (roller_model.count - row) * sizeof(roller_model.ids[0]));
+    memmove(&roller_model.lengths[row], &roller_model.lengths[row + 1], roller_model.count - row);
+}
+
+// Rows whose notification is gone are dropped first, what is left is in the store's order (newest
+//  first, survivors never reorder), so walking both side by side any notification that isn't the
+//  next row is new and goes in right there
+static bool roller_model_sync(void)
+{
+    uint8_t row = 0;
+    bool changed = false;
+
+    if (roller_model.revision == notificationRevision) return false;
+
+    while (row < roller_model.count)
+    {
+        if (findNotification(roller_model.ids[row]) < 0)
+        {
+            roller_row_remove(row);
+            changed = true;
+        }
+        else row++;
+    }
+
+    for (uint8_t index = 0; index < notificationCount; index++)
+    {
+        if (index == roller_model.count || roller_model.ids[index] != activeNotifications[index].id)
+        {
+            roller_row_insert(index, &activeNotifications[index]);
+            changed = true;
+        }
+    }
+
+    roller_model.revision = notificationRevision;
+    return changed;
+}
+
+// Notification behind the selected roller row, NULL for the extra rows or if it has been cleared since
+static Notification* roller_selected_notification(void)
+{
+    uint16_t row = lv_roller_get_selected(notificationScreenObj.roller);
+    int8_t index;
+
+    if (row >= roller_model.count) return NULL;
+    index = findNotification(roller_model.ids[row]);
+    return (index < 0) ? NULL : &activeNotifications[index];
+}
+
+// Pixels LVGL actually redrew, fed by the display driver's monitor callback after every refresh
+static Display_Refresh_Stats refresh_stats;
+
+#ifdef CONFIG_GECKO_TAP_TRACE
+// A refresh's last flush can still be queued for the flush thread or on the wire when LVGL calls
+//  it done, so the photon is when the driver has finished as many flushes as LVGL had handed out
+static void (*lvgl_flush_cb)(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+static bool trace_flush_events = false;     // Driver reports flush edges (needs CONFIG_GC9A01_STATS)
+static uint32_t trace_flushes_issued;
+static atomic_t trace_flushes_done = ATOMIC_INIT(0);
+static uint32_t trace_photon_target;
+static atomic_t trace_photon_waiting = ATOMIC_INIT(0);
+
+static void display_trace_photon(void)
+{
+    if (!atomic_get(&trace_photon_waiting)) return;
+    if ((int32_t)((uint32_t) atomic_get(&trace_flushes_done) - trace_photon_target) < 0) return;
+    if (atomic_cas(&trace_photon_waiting, 1, 0)) traceMark(TRACE_PHOTON);
+}
+
+static void display_trace_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p)
+{
+    trace_flushes_issued++;
+    // Without the driver's edges, handing the area over is as close as it gets
+    if (!trace_flush_events) traceMark(TRACE_FLUSH_BEGIN);
+    lvgl_flush_cb(disp_drv, area, color_p);
+}
+
+// Runs in the SPI completion interrupt for the end of an asynchronous flush
+static void display_flush_event_cb(const struct device *dev, enum gc9a01_flush_event event, void *user_data)
+{
+    if (event == GC9A01_FLUSH_BEGIN)
+    {
+        traceMark(TRACE_FLUSH_BEGIN);
+        return;
+    }
+    atomic_inc(&trace_flushes_done);
+    display_trace_photon();
+}
+#endif
+
+static void display_monitor_cb(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px)
+{
+    refresh_stats.refreshes++;
+    refresh_stats.last_pixels = px;
+    refresh_stats.last_time_ms = time;
+    refresh_stats.total_pixels += px;
+
+#ifdef CONFIG_GECKO_TAP_TRACE
+    if (traceTapInFlight())
+    {
+        traceMark(TRACE_RENDER_DONE);
+        if (trace_flush_events)
+        {
+            trace_photon_target = trace_flushes_issued;
+            atomic_set(&trace_photon_waiting, 1);
+            display_trace_photon();
+        }
+        else traceMark(TRACE_PHOTON);
+    }
+#endif
+}
+
+void display_get_refresh_stats(Display_Refresh_Stats* stats)
+{
+    *stats = refresh_stats;
+}
+
+// Minute ticks only redraw the clock digits that changed
+static void set_clock(lv_obj_t* clock)
+{
+    struct tm* current_time;
+
+    getTime(&current_time);
+    clock_widget_set_time(clock, current_time);
+}
+
+// Runs in the TE interrupt
+static void display_vsync_cb(const struct device *dev, void *user_data)
+{
+    if (atomic_get(&vsync_armed)) k_event_post(&userInteractionEvent, SYSTEM_EVENT_VSYNC);
+}
+
+// Step the roller, with the animation running off vsync when the panel gives us one
+static void display_roller_select(uint16_t index)
+{
+    lv_roller_set_selected(notificationScreenObj.roller, index, roller_anim);
+    if (roller_anim == LV_ANIM_ON) atomic_set(&vsync_armed, 1);
+}
+
+// LVGL v8 has no public way to get at a display's refresh timer or to ask if anything is waiting to
+//  be drawn, the governor reads its internals for both and only through these two. Porting to a
+//  newer LVGL starts here (v9 also hides lv_timer_t, the period/paused reads below go with it).
+#if LVGL_VERSION_MAJOR != 8
+#error "display_refr_timer() and display_has_invalid_areas() rely on LVGL v8 internals"
+#endif
+
+static lv_timer_t* display_refr_timer(void)
+{
+    return _lv_disp_get_refr_timer(lv_disp_get_default());
+}
+
+static bool display_has_invalid_areas(void)
+{
+    return lv_disp_get_default()->inv_p != 0;
+}
+
+// Called from the main loop on SYSTEM_EVENT_VSYNC, lines LVGL's next refresh up with the panel's
+void display_handle_vsync(void)
+{
+    if (lv_anim_count_running() == 0)
+    {
+        atomic_clear(&vsync_armed);
+        return;
+    }
+
+    // Step the animations and make the refresh timer due so the following lv_timer_handler() draws now
+    lv_anim_refr_now();
+    lv_timer_ready(display_refr_timer());
+}
+
 // Handle single and double tap, updating and moving screens if neccesary
 void display_handle_tap(Tap_t tap)
 {
+    Notification* notification;
+
     if (tap == TAP_SINGLE)
     {
         switch (active_screen)
@@ -171,9 +805,7 @@ void display_handle_tap(Tap_t tap)
                 if (notificationScreenObj.roller_is_active)
                 {    
                     // Increment the notification roller and update screen
-                    lv_roller_set_selected(notificationScreenObj.roller, 
-                                            (lv_roller_get_selected(notificationScreenObj.roller) + 1) % (notificationCount + 2), // Extra +2 for "go back" and "clear all"
-                                            LV_ANIM_OFF);
+                    display_roller_select((lv_roller_get_selected(notificationScreenObj.roller) + 1) % (roller_model.count + 2)); // Extra +2 for "go back" and "clear all"
                 }
                 else
                 {
@@ -182,6 +814,13 @@ void display_handle_tap(Tap_t tap)
                 }
                 break;
             case SCREEN_NOTIFICATION_DETAILED:
+                // Long messages move on a page per tap until the end is showing
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+                if (detailed_page_next()) break;
+#else
+                if (detailed_scroll_page()) break;
+#endif
+
                 // Single tap just moves back to normal notification screen without clearing the notification
                 // As of now this will mean we are put outside the roller back at the first notification
                 display_switch_screen(SCREEN_NOTIFICATION_SUMMARY);
@@ -215,14 +854,14 @@ void display_handle_tap(Tap_t tap)
                 {    
                     // We are selecting a notificaiton, if "Go Back" was selected we move out of roller, otherwise go to detailed view
                     // "Go Back" is appended as the last notification so it's index is the number of notifications
-                    if (lv_roller_get_selected(notificationScreenObj.roller) == notificationCount) 
+                    if (lv_roller_get_selected(notificationScreenObj.roller) == roller_model.count)
                     {
                         // Go back was selected, set roller to inactive and remove active indicator
                         notificationScreenObj.roller_is_active = false;
-                        lv_obj_add_flag(notificationScreenObj.roller_active_marker_inner, LV_OBJ_FLAG_HIDDEN);
-                        lv_obj_add_flag(notificationScreenObj.roller_active_marker_outer, LV_OBJ_FLAG_HIDDEN);
+                        view_set_hidden(notificationScreenObj.roller_active_marker_inner, true);
+                        view_set_hidden(notificationScreenObj.roller_active_marker_outer, true);
                     }
-                    else if (lv_roller_get_selected(notificationScreenObj.roller) == notificationCount + 1)
+                    else if (lv_roller_get_selected(notificationScreenObj.roller) == roller_model.count + 1)
                     {
                         // Clear all was selected, remove all notifications and force refresh screen
                         clearNotifications();
@@ -236,18 +875,19 @@ void display_handle_tap(Tap_t tap)
                 else
                 {
                     // We want to move into roller but only if there are active notifications
-                    if (notificationCount > 0)
+                    if (roller_model.count > 0)
                     {
                         // Make sure to show the outer indicator for being "inside" the roller
                         notificationScreenObj.roller_is_active = true;
-                        lv_obj_clear_flag(notificationScreenObj.roller_active_marker_inner, LV_OBJ_FLAG_HIDDEN);
-                        lv_obj_clear_flag(notificationScreenObj.roller_active_marker_outer, LV_OBJ_FLAG_HIDDEN);
+                        view_set_hidden(notificationScreenObj.roller_active_marker_inner, false);
+                        view_set_hidden(notificationScreenObj.roller_active_marker_outer, false);
                     }
                 }
                 break;
             case SCREEN_NOTIFICATION_DETAILED:
                 // Now we want to clear the active notification and go back to the summary screen
-                clearNotification(lv_roller_get_selected(notificationScreenObj.roller));
+                notification = roller_selected_notification();
+                if (notification) clearNotification(notification - activeNotifications);
                 display_switch_screen(SCREEN_NOTIFICATION_SUMMARY);
                 break;
             case SCREEN_DEVICE_STATUS:
@@ -270,24 +910,129 @@ void display_handle_tap(Tap_t tap)
     }
 }
 
+// True while LVGL has to keep drawing on its own (animations, the detailed body scrolling)
+static bool display_is_animating(void)
+{
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    if (detailed_scroll_pending > 0) return true;
+#endif
+    return lv_anim_count_running() > 0;
+}
+
+// Run LVGL's timers, returns ms until it next needs to run or LV_NO_TIMER_READY if only an event can
+//  give it work. Replaces calling lv_timer_handler() directly from the main loop.
+uint32_t display_lvgl_service(void)
+{
+    lv_timer_t* refr_timer = display_refr_timer();
+    uint32_t start = k_cycle_get_32();
+    uint32_t period;
+    uint32_t next;
+
+    // Taps and updates since the last run invalidate without waking the (parked) refresh timer
+    if (display_has_invalid_areas() || display_is_animating()) lv_timer_resume(refr_timer);
+
+    next = lv_timer_handler();
+
+    period = display_is_animating() ? DISPLAY_BOOST_PERIOD_MS : LV_DISP_DEF_REFR_PERIOD;
+    if (refr_timer->period != period)
+    {
+        lv_timer_set_period(refr_timer, period);
+        lv_timer_set_period(lv_anim_get_timer(), period);
+    }
+
+    // Nothing left to draw, park the refresh timer so the only deadline left is a real one
+    if (!display_has_invalid_areas() && !display_is_animating() && !refr_timer->paused)
+    {
+        lv_timer_pause(refr_timer);
+        next = lv_timer_handler();
+    }
+
+    if (governor_awake)
+    {
+        governor_wakeups++;
+        governor_lvgl_cycles += k_cycle_get_32() - start;
+    }
+
+    return next;
+}
+
+void display_get_governor_stats(Display_Governor_Stats* stats)
+{
+    stats->awake_ms = governor_awake ? k_uptime_get_32() - governor_awake_start : 0;
+    stats->wakeups = governor_wakeups;
+    stats->lvgl_us = k_cyc_to_us_floor64(governor_lvgl_cycles);
+}
+
+static void governor_start(void)
+{
+    governor_awake = true;
+    governor_awake_start = k_uptime_get_32();
+    governor_wakeups = 0;
+    governor_lvgl_cycles = 0;
+}
+
+static void governor_stop(void)
+{
+#ifdef CONFIG_GECKO_DISPLAY_GOVERNOR_REPORT
+    Display_Governor_Stats stats;
+
+    display_get_governor_stats(&stats);
+    if (stats.awake_ms)
+    {
+        printf("Awake %u ms: %u LVGL wakeups (%u.%u /s), %u us in LVGL (%u.%u %% CPU)\n",
+            stats.awake_ms, stats.wakeups, stats.wakeups * 1000 / stats.awake_ms, (stats.wakeups * 10000 / stats.awake_ms) % 10,
+            stats.lvgl_us, stats.lvgl_us / 10 / stats.awake_ms, (stats.lvgl_us / stats.awake_ms) % 10);
+    }
+    flash_resources_print_report();
+#endif
+    governor_awake = false;
+}
+
 void display_wake(void)
 {
+    governor_start();
+#if ALWAYS_ON_ENABLED
+    gc9a01_always_on_exit(display_dev);
+#else
     display_blanking_off(display_dev);
+#endif
     display_switch_screen(SCREEN_HOME);
     set_brightness(active_brightness / 100.0, 0);
 }
 
 void display_sleep(void)
 {
+#if ALWAYS_ON_ENABLED
+    // Panel goes to partial + idle mode first so the redraw below never shows outside the band
+    gc9a01_always_on_enter(display_dev, ALWAYS_ON_BAND_START_ROW, ALWAYS_ON_BAND_END_ROW);
+    set_brightness(ALWAYS_ON_BRIGHTNESS / 100.0, 0);
+    display_switch_screen(SCREEN_ALWAYS_ON);
+    lv_refr_now(NULL);
+    screens_teardown();
+#else
     set_brightness(0.0, 0);
     display_blanking_on(display_dev);
+    screens_teardown();
+#endif
     notificationScreenObj.roller_is_active = false;
+    governor_stop();
+}
+
+// Minute tick while asleep, redraw the always-on time (only the label area goes out)
+void display_always_on_update(void)
+{
+    if (active_screen != SCREEN_ALWAYS_ON) return;
+
+    display_switch_screen(SCREEN_ACTIVE);
+    lv_refr_now(NULL);
 }
 
 void temp_action(void)
 {
-    uint8_t newIndex = (lv_roller_get_selected(notificationScreenObj.roller) + 1) % (notificationCount + 1); // Extra +1 for "go back"
-    lv_roller_set_selected(notificationScreenObj.roller, newIndex, LV_ANIM_OFF); // We don't have the update fps for smooth ANIM
+    if (!notificationScreenObj.lvgl_object) return;
+
+    uint8_t newIndex = (lv_roller_get_selected(notificationScreenObj.roller) + 1) % (roller_model.count + 1); // Extra +1 for "go back"
+    display_roller_select(newIndex);
 }
 
 Screen_Type get_active_screen(void)
@@ -299,15 +1044,31 @@ Screen_Type get_active_screen(void)
 void display_switch_screen(Screen_Type new_screen)
 {
     char text_buffer[64];
-    struct tm* current_time;
     uint8_t len;
-    char* copy_index = notification_roller_buffer; 
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    bool body_changed = false;
+#endif
     Notification* activeNotification;
 
     if (!screen_initialized) return;
 
     if (new_screen == SCREEN_ACTIVE) new_screen = active_screen;
-    else active_screen = new_screen;
+    else
+    {
+        // Leaving a rarely used screen, start counting down to freeing it
+        if (new_screen != active_screen && screen_defs[active_screen].transient)
+        {
+            lv_timer_reset(screen_teardown_timer);
+            lv_timer_resume(screen_teardown_timer);
+        }
+        active_screen = new_screen;
+    }
+    screen_get(new_screen);
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    // Leaving the detailed notification, hand the panel back its normal row layout before anything redraws
+    if (new_screen != SCREEN_NOTIFICATION_DETAILED) detailed_scroll_enable(false);
+#endif
 
     switch(new_screen)
     {
@@ -315,109 +1076,106 @@ void display_switch_screen(Screen_Type new_screen)
             /*
                 Need to update the time, notification status, and battery percent/voltage
             */
-            // Get and print the time in the standard US format and make sure to remove the leading zero if hour is 1-9
-            getTime(&current_time);
-            strftime(text_buffer, sizeof(text_buffer), "%I:%M %p", current_time);
-            if (current_time->tm_hour % 12 >= 10 || current_time->tm_hour % 12 == 0) lv_label_set_text(homeScreenObj.time_label, text_buffer);
-            else lv_label_set_text(homeScreenObj.time_label, &text_buffer[1]);
+            set_clock(homeScreenObj.clock);
 
             // Notification status
-            if (notificationCount)
-            {
-                lv_obj_clear_flag(homeScreenObj.notification_marker_outer, LV_OBJ_FLAG_HIDDEN);
-                lv_obj_clear_flag(homeScreenObj.notification_marker_inner, LV_OBJ_FLAG_HIDDEN);
-            }
-            else
-            {
-                lv_obj_add_flag(homeScreenObj.notification_marker_outer, LV_OBJ_FLAG_HIDDEN);
-                lv_obj_add_flag(homeScreenObj.notification_marker_inner, LV_OBJ_FLAG_HIDDEN);     
-            }
+            view_set_hidden(homeScreenObj.notification_marker_outer, notificationCount == 0);
+            view_set_hidden(homeScreenObj.notification_marker_inner, notificationCount == 0);
 
             // Battery percent/voltage
             snprintf(text_buffer, 64, "?? %% / %.2f V", batteryReadVoltage() / 1000.0);
-            lv_label_set_text(homeScreenObj.battery_percent_label, text_buffer);
+            view_set_text(homeScreenObj.battery_percent_label, text_buffer);
 
-            lv_scr_load(homeScreenObj.lvgl_object);
+            view_load_screen(homeScreenObj.lvgl_object);
             break;
         case SCREEN_NOTIFICATION_SUMMARY:
             /*
-                Need to get the active notification app names and create the lvgl roller string.
-                If we have already created the string and we are just updating we need to recreate the string and set the current position
-                Make sure to always include the "Go Back" and "Clear All" options 
-
-                Note that the notification indices in the notification buffer aren't sorted by timestamp so 
-                    neither will the display order be
+                Bring the roller in step with the notification store, only what was added or removed
+                since the last visit is touched. Make sure to always include the "Go Back" and "Clear All" options
             */
-            if (notificationCount > 0)
-            {
-                for (int i = 0; i < notificationCount; i++)
-                {
-                    len = strlen(activeNotifications[i].appName);
-                    strncpy(copy_index, activeNotifications[i].appName, len);
-                    copy_index += len;
-                    *copy_index++ = '\n';
-                }
-                strcpy(copy_index, "[Exit Roller]\n[Clear All]\n");
-
-                lv_roller_set_options(notificationScreenObj.roller, notification_roller_buffer, LV_ROLLER_MODE_INFINITE);
-            }
-            else
+            if (roller_model_sync())
             {
                 lv_roller_set_options(notificationScreenObj.roller,
-                    "No Current Messages\n",
-                    LV_ROLLER_MODE_INFINITE);
+                    roller_model.count ? notification_roller_buffer : ROLLER_EMPTY, LV_ROLLER_MODE_INFINITE);
             }
             // Always start "outside" the roller
             notificationScreenObj.roller_is_active = false;
-            lv_obj_add_flag(notificationScreenObj.roller_active_marker_outer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(notificationScreenObj.roller_active_marker_inner, LV_OBJ_FLAG_HIDDEN);
-            lv_scr_load(notificationScreenObj.lvgl_object);
+            view_set_hidden(notificationScreenObj.roller_active_marker_outer, true);
+            view_set_hidden(notificationScreenObj.roller_active_marker_inner, true);
+            view_load_screen(notificationScreenObj.lvgl_object);
             break;
         case SCREEN_NOTIFICATION_DETAILED:
-            if (notificationCount > 0)
+            screen_get(SCREEN_NOTIFICATION_SUMMARY); // The roller selection picks the message
+            // The active notification (that we are viewing) will be the current roller notification
+            activeNotification = roller_selected_notification();
+            if (activeNotification)
             {
-                // The active notification (that we are viewing) will be the current roller notification
                 // Need to update the App Name, Notification Title, Timestamp, and Notification body 
-                activeNotification = &activeNotifications[lv_roller_get_selected(notificationScreenObj.roller)];
-                lv_label_set_text(detailedNotificationScreenObj.app_label, activeNotification->appName);
-                lv_label_set_text(detailedNotificationScreenObj.message_body_label, activeNotification->text);
+                view_set_text(detailedNotificationScreenObj.app_label, activeNotification->appName);
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+                detailed_body_set(activeNotification, lv_scr_act() != detailedNotificationScreenObj.lvgl_object);
+#else
+                body_changed = strcmp(lv_label_get_text(detailedNotificationScreenObj.message_body_label), activeNotification->text) != 0;
+                view_set_text(detailedNotificationScreenObj.message_body_label, activeNotification->text);
+#endif
 
                 len = (uint8_t) snprintf(text_buffer, sizeof(text_buffer), "%s | ", activeNotification->title);
                 strftime(&text_buffer[len], sizeof(text_buffer) - len - 1, "%I:%M %p", gmtime(&(activeNotification->timestamp))); // -1 for null term as len doesn't include it
-                lv_label_set_text(detailedNotificationScreenObj.message_title_label, text_buffer);
+                view_set_text(detailedNotificationScreenObj.message_title_label, text_buffer);
             }
             else
             {
-                lv_label_set_text(detailedNotificationScreenObj.app_label, "NONE");
-                lv_label_set_text(detailedNotificationScreenObj.message_body_label, "NONE");
-                lv_label_set_text(detailedNotificationScreenObj.message_title_label, "NONE");
+                view_set_text(detailedNotificationScreenObj.app_label, "NONE");
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+                detailed_body_set(NULL, true);
+#else
+                body_changed = strcmp(lv_label_get_text(detailedNotificationScreenObj.message_body_label), "NONE") != 0;
+                view_set_text(detailedNotificationScreenObj.message_body_label, "NONE");
+#endif
+                view_set_text(detailedNotificationScreenObj.message_title_label, "NONE");
             }
-            lv_scr_load(detailedNotificationScreenObj.lvgl_object);
+
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+            // New message (or coming in from another screen), start at the top of the body and only
+            //  bother with hardware scroll if it doesn't all fit. A refresh of the same one stays put.
+            if (body_changed || lv_scr_act() != detailedNotificationScreenObj.lvgl_object)
+            {
+                lv_obj_scroll_to_y(detailedNotificationScreenObj.message_body_box, 0, LV_ANIM_OFF);
+                lv_obj_update_layout(detailedNotificationScreenObj.message_body_box);
+                detailed_scroll_enable(lv_obj_get_scroll_bottom(detailedNotificationScreenObj.message_body_box) > 0);
+                lv_obj_invalidate(detailedNotificationScreenObj.lvgl_object);
+            }
+#endif
+            view_load_screen(detailedNotificationScreenObj.lvgl_object);
             break;
         case SCREEN_DEVICE_STATUS:
             // Currently do not have hardware to support percentage, can implement after new hardware revision
-            lv_label_set_text(deviceScreenObj.battery_percent_label, "Battery Percentage: ??");
+            view_set_text(deviceScreenObj.battery_percent_label, "Battery Percentage: ??");
 
             // Check if we are connected
-            if (bluetoothConnected) lv_label_set_text(deviceScreenObj.bluetooth_label, "Bluetooth Status: Connected");
-            else lv_label_set_text(deviceScreenObj.bluetooth_label, "Bluetooth Status: Disconnected");
+            if (bluetoothConnected) view_set_text(deviceScreenObj.bluetooth_label, "Bluetooth Status: Connected");
+            else view_set_text(deviceScreenObj.bluetooth_label, "Bluetooth Status: Disconnected");
 
             snprintf(text_buffer, sizeof(text_buffer), "Battery Voltage: %.2f V", batteryReadVoltage() / 1000.0);
-            lv_label_set_text(deviceScreenObj.voltage_label, text_buffer);
+            view_set_text(deviceScreenObj.voltage_label, text_buffer);
 
-            lv_scr_load(deviceScreenObj.lvgl_object);
+            view_load_screen(deviceScreenObj.lvgl_object);
             break;
         case SCREEN_DEVICE_BRIGHTNESS:
             snprintf(text_buffer, sizeof(text_buffer), "Brightness: %i %%", active_brightness);
-            lv_label_set_text(deviceBrightnessScreenObj.brightness_label, text_buffer);
+            view_set_text(deviceBrightnessScreenObj.brightness_label, text_buffer);
 
-            lv_scr_load(deviceBrightnessScreenObj.lvgl_object);
+            view_load_screen(deviceBrightnessScreenObj.lvgl_object);
             break;
         case SCREEN_CHARGING:
             snprintf(text_buffer, sizeof(text_buffer), "Charging... ?? %% / %.2f V", batteryReadVoltage() / 1000.0);
-            lv_label_set_text(chargingScreenObj.charging_label, text_buffer);
+            view_set_text(chargingScreenObj.charging_label, text_buffer);
 
-            lv_scr_load(chargingScreenObj.lvgl_object);
+            view_load_screen(chargingScreenObj.lvgl_object);
+            break;
+        case SCREEN_ALWAYS_ON:
+            set_clock(alwaysOnScreenObj.clock);
+            view_load_screen(alwaysOnScreenObj.lvgl_object);
             break;
         default:
             // Do nothing, should never hit this
@@ -444,24 +1202,39 @@ int display_lvgl_init(void)
 
     display_set_brightness(display_dev, (active_brightness / 100.0) * 255);
 
-    // Create all main objects (screens) and their children objects
-    init_display_objects();
+    // Count what every refresh actually redraws
+    lv_disp_get_default()->driver->monitor_cb = display_monitor_cb;
+
+#ifdef CONFIG_GECKO_TAP_TRACE
+    // Tap latency trace follows the redraw down to the last byte on the wire
+    lvgl_flush_cb = lv_disp_get_default()->driver->flush_cb;
+    lv_disp_get_default()->driver->flush_cb = display_trace_flush_cb;
+    trace_flush_events = (gc9a01_flush_callback_set(display_dev, display_flush_event_cb, NULL) == 0);
+#endif
+
+    // Panel TE line is optional, only animate the roller when we can pace frames off it
+    display_has_vsync = (gc9a01_vsync_callback_set(display_dev, display_vsync_cb, NULL) == 0);
+    roller_anim = display_has_vsync ? LV_ANIM_ON : LV_ANIM_OFF;
+
+    // Compressed image assets are decoded line by line as they are drawn
+    asset_decoder_init();
+
+    // Screens are built as they are first shown, only the home screen is needed now
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    detailed_scroll_timer = lv_timer_create(detailed_scroll_timer_cb, DETAILED_SCROLL_PERIOD_MS, NULL);
+    lv_timer_pause(detailed_scroll_timer);
+#endif
+    screen_teardown_timer = lv_timer_create(screen_teardown_timer_cb, SCREEN_TEARDOWN_IDLE_MS, NULL);
+    lv_timer_pause(screen_teardown_timer);
 
     // Start with the display on the home screen
-    lv_scr_load(homeScreenObj.lvgl_object);
+    lv_scr_load(screen_get(SCREEN_HOME));
     active_screen = SCREEN_HOME;
     screen_initialized = true;
     display_switch_screen(SCREEN_ACTIVE);
+    governor_start();
 
     // Be optimistic and assume it all worked :)
     printf(ANSI_COLOR_GREEN "OK" ANSI_COLOR_RESET "\n");
     return 0;
 }
-
-
-
-
-
-
-
-
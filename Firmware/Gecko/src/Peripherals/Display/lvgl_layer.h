@@ -17,6 +17,7 @@ typedef enum {
     SCREEN_DEVICE_STATUS,
     SCREEN_DEVICE_BRIGHTNESS,
     SCREEN_CHARGING,
+    SCREEN_ALWAYS_ON,
     SCREEN_TYPE_COUNT // number of screens, not an actual screen
 } Screen_Type;
 
@@ -25,7 +26,7 @@ typedef struct {
     lv_obj_t* notification_marker_outer;
     lv_obj_t* notification_marker_inner;
     lv_obj_t* screen_saver;
-    lv_obj_t* time_label;
+    lv_obj_t* clock;
     lv_obj_t* battery_percent_label;
 } Home_Screen;
 
@@ -41,7 +42,13 @@ typedef struct {
     lv_obj_t* lvgl_object;
     lv_obj_t* app_label;
     lv_obj_t* message_title_label;
+#ifdef CONFIG_GECKO_DETAILED_BODY_SCROLL
+    lv_obj_t* message_body_box; // Scrollable window the body label sits in
+#endif
     lv_obj_t* message_body_label;
+#ifdef CONFIG_GECKO_DETAILED_BODY_PAGED
+    lv_obj_t* message_page_label;   // "2/3" while the body has more than one page
+#endif
 } Notification_Detailed_Screen;
 
 typedef struct {
@@ -61,6 +68,34 @@ typedef struct {
     lv_obj_t* charging_label;
 } Charging_Screen;
 
+typedef struct {
+    lv_obj_t* lvgl_object;
+    lv_obj_t* clock;
+} Always_On_Screen;
+
+// What LVGL has redrawn, to see how much a screen update really costs
+typedef struct {
+    uint32_t refreshes;
+    uint32_t last_pixels;   // Pixels redrawn by the last refresh
+    uint32_t last_time_ms;  // Render + flush time of the last refresh
+    uint64_t total_pixels;
+} Display_Refresh_Stats;
+
+// LVGL heap use, to size CONFIG_LV_MEM_SIZE_KILOBYTES
+typedef struct {
+    uint32_t total;
+    uint32_t used;
+    uint32_t max_used;                          // High-water mark since boot
+    uint32_t screen_bytes[SCREEN_TYPE_COUNT];   // What each screen took when last built, 0 if never
+} Display_Heap_Stats;
+
+// LVGL activity over the current awake window
+typedef struct {
+    uint32_t awake_ms;
+    uint32_t wakeups;   // Times the main loop ran LVGL
+    uint32_t lvgl_us;   // CPU time spent in LVGL
+} Display_Governor_Stats;
+
 extern lv_disp_t* activeDisplay;
 
 int display_lvgl_init(void);
@@ -69,7 +104,14 @@ void set_brightness(float brightness, bool makeDefault);
 Screen_Type get_active_screen(void);
 void display_wake(void);
 void display_sleep(void);
+void display_always_on_update(void);
 void display_handle_tap(Tap_t tap);
+void display_handle_vsync(void);
+void display_get_refresh_stats(Display_Refresh_Stats* stats);
+void display_get_heap_stats(Display_Heap_Stats* stats);
+void display_print_heap_report(void);
+uint32_t display_lvgl_service(void);
+void display_get_governor_stats(Display_Governor_Stats* stats);
 
 void temp_action(void);
 
@@ -3,6 +3,24 @@
 #include <zephyr/drivers/spi.h>
 
 #include "system.h"
+#include "externalFlash.h"
+
+#define EFLASH_CMD_FAST_READ    0x0B // Address then one dummy byte, good past the 32 MHz we run the bus at
+
+// The display shares the bus, the driver handles CS so a read is one locked transaction
+static struct spi_config eflash_spi_cfg = {
+    .frequency = 32000000,
+    .operation = SPI_WORD_SET(8),
+    .slave = 0,
+    .cs = {
+        .gpio = {
+            .port = DEVICE_DT_GET(GPIO_0_DEVICE_LABEL),
+            .pin = EFLASH_CS_PIN,
+            .dt_flags = GPIO_ACTIVE_LOW
+        },
+        .delay = 0
+    }
+};
 
 static struct spi_buf_set spi_tx_buffer_set;
 static struct spi_buf tx_spi_buf;
@@ -28,8 +46,8 @@ void readRegisters(void)
 
     command = 0x05;
 
-    // Send CS low
-    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 0);
+    // Send CS low (logical 1, the pin is configured active low)
+    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
 
     // Send the command
     spi_write(spi_dev, &spi_cfg, &spi_tx_buffer_set);
@@ -37,8 +55,8 @@ void readRegisters(void)
     // Read back the response
     spi_read(spi_dev, &spi_cfg, &spi_rx_buffer_set);
 
-    // Set CS high again
-    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
+    // Set CS high again (logical 0)
+    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 0);
 
     printf("S0:  %u\r\n", response & 1);
     printf("S1:  %u\r\n", (response >> 1) & 1);
@@ -53,8 +71,8 @@ void readRegisters(void)
 
     command = 0x35;
 
-    // Send CS low
-    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 0);
+    // Send CS low (logical 1, the pin is configured active low)
+    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
 
     // Send the command
     spi_write(spi_dev, &spi_cfg, &spi_tx_buffer_set);
@@ -62,8 +80,8 @@ void readRegisters(void)
     // Read back the response
     spi_read(spi_dev, &spi_cfg, &spi_rx_buffer_set);
 
-    // Set CS high again
-    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
+    // Set CS high again (logical 0)
+    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 0);
 
     printf("S8:  %u\r\n", response & 1);
     printf("S9:  %u\r\n", (response >> 1) & 1);
@@ -78,8 +96,8 @@ void readRegisters(void)
 
     command = 0x15;
 
-    // Send CS low
-    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 0);
+    // Send CS low (logical 1, the pin is configured active low)
+    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
 
     // Send the command
     spi_write(spi_dev, &spi_cfg, &spi_tx_buffer_set);
@@ -87,8 +105,8 @@ void readRegisters(void)
     // Read back the response
     spi_read(spi_dev, &spi_cfg, &spi_rx_buffer_set);
 
-    // Set CS high again
-    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
+    // Set CS high again (logical 0)
+    gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 0);
 
     printf("S16: %u\r\n", response & 1);
     printf("S17: %u\r\n", (response >> 1) & 1);
@@ -101,13 +119,27 @@ void readRegisters(void)
     printf("-----------------------------------------\r\n\n");
 }
 
+int externalFlashRead(uint32_t address, void* data, size_t length)
+{
+    uint8_t command[5] = {EFLASH_CMD_FAST_READ, address >> 16, address >> 8, address, 0x00};
+    struct spi_buf tx_buf = {.buf = command, .len = sizeof(command)};
+    struct spi_buf rx_bufs[2] = {
+        {.buf = NULL, .len = sizeof(command)}, // Clocked in while the command goes out
+        {.buf = data, .len = length}
+    };
+    const struct spi_buf_set tx_set = {.buffers = &tx_buf, .count = 1};
+    const struct spi_buf_set rx_set = {.buffers = rx_bufs, .count = 2};
+
+    return spi_transceive(spi_dev, &eflash_spi_cfg, &tx_set, &rx_set);
+}
+
 int externalFlashInit(void)
 {
     int error;
     printf("Init External Flash...");
 
-    error = gpio_pin_configure(gpio0_dev, EFLASH_CS_PIN, GPIO_OUTPUT);
-    error += gpio_pin_set(gpio0_dev, EFLASH_CS_PIN, 1);
+    // Configured active low so the SPI driver drives it the same way for externalFlashRead()
+    error = gpio_pin_configure(gpio0_dev, EFLASH_CS_PIN, GPIO_OUTPUT_INACTIVE | GPIO_ACTIVE_LOW);
     if (error)
     {
         printf(ANSI_COLOR_RED "ERR" ANSI_COLOR_RESET "\n");
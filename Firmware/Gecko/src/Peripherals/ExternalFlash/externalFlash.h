@@ -1,7 +1,11 @@
 #ifndef __EXTERNAL_FLASH_H__
 #define __EXTERNAL_FLASH_H__
 
+#include <stdint.h>
+#include <stddef.h>
+
 void readRegisters(void);
 int externalFlashInit(void);
+int externalFlashRead(uint32_t address, void* data, size_t length);
 
 #endif // __EXTERNAL_FLASH_H__
\ No newline at end of file
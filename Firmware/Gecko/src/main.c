@@ -13,6 +13,7 @@
 
 #include "system.h"
 #include "clock.h"
+#include "trace.h"
 #include "Peripherals/BMA400/bma400.h" 
 #include "Peripherals/BMA400/common.h" 
 #include "Peripherals/BMA400/taps.h" 
@@ -22,6 +23,7 @@
 #include "Peripherals/Buzzer/buzzer.h"
 #include "BLE/BLE.h"
 #include "Peripherals/Display/lvgl_layer.h"
+#include "Peripherals/Display/flash_resources.h"
 
 LOG_MODULE_REGISTER(GeckoMain, CONFIG_LOG_DEFAULT_LEVEL);
 
@@ -38,6 +40,34 @@ static const struct device* display_dev 	= DEVICE_DT_GET(DT_CHOSEN(zephyr_displa
 	const struct device* i2c_dev 	= DEVICE_DT_GET(I2C_DEVICE_LABEL);
 #endif
 
+// Boot timeline, uptime at the end of each init stage so slow stages stand out
+#define BOOT_STAGE_MAX 12
+static struct {
+	const char* name;
+	uint32_t ms;
+} bootTimeline[BOOT_STAGE_MAX];
+static uint8_t bootStageCount = 0;
+
+static void bootMark(const char* name)
+{
+	if (bootStageCount >= BOOT_STAGE_MAX) return;
+	bootTimeline[bootStageCount].name = name;
+	bootTimeline[bootStageCount].ms = k_uptime_get_32();
+	bootStageCount++;
+}
+
+static void bootPrintTimeline(void)
+{
+	uint32_t lastMs = 0;
+
+	printf("Boot timeline (ms since kernel start):\n");
+	for (int i = 0; i < bootStageCount; i++)
+	{
+		printf("  %5u ms (+%4u)  %s\n", bootTimeline[i].ms, bootTimeline[i].ms - lastMs, bootTimeline[i].name);
+		lastMs = bootTimeline[i].ms;
+	}
+}
+
 static bool systemAwake = true;
 struct tm* mTime;
 char timeBuffer[64];
@@ -47,28 +77,43 @@ static bool systemInit(void)
 {
 	int error = 0;
 	printf("*************************\n  Initializing System...  \n*************************\n");
+	bootMark("Kernel and drivers");
+
+	// The display controller is still coming out of reset on the driver's own gc9a01_workq while
+	//  everything below runs, it only holds up the first frame if it isn't done by then
 
 	// BLE
 	error = BLE_init();
+	bootMark("BLE");
 
 	// Taps/BMA400
 	k_event_init(&userInteractionEvent);
 	error += bma400Init();
+	bootMark("BMA400");
 
 	// System Clock
 	error += clockInit();
+	bootMark("Clock");
 
 	// Power and battery management
 	error += batteryMonitorInit();
+	bootMark("Battery monitor");
 
 	// External Flash
 	error += externalFlashInit();
+	bootMark("External flash");
+
+	// Fonts and images on the external flash, a blank flash just means the built in ones are used
+	flash_resources_init();
+	bootMark("Flash resources");
 
 	// Buzzer
 	error += buzzerInit();
+	bootMark("Buzzer");
 
 	// Display
 	error += display_lvgl_init();
+	bootMark("LVGL screens");
 
 	if (error)
 	{
@@ -173,11 +218,18 @@ int main(void)
 	k_timer_init(&systemSleepTimer, systemSleepCallback, NULL);
 	k_timer_start(&systemSleepTimer, K_SECONDS(5), K_SECONDS(5));
 
+	// First pass draws the home screen
+	lv_timer_handler();
+	bootMark("Home screen drawn");
+	bootPrintTimeline();
+	display_print_heap_report();
+
 	for(;;)
 	{
-		// Wait on system events or if we are awake, keep updating display
-		timeTillNext = lv_timer_handler();
-		triggeredEvent = ((systemAwake) ? k_event_wait(&userInteractionEvent, SYSTEM_EVENT_MAIN_MASK, true, K_MSEC(timeTillNext)) : k_event_wait(&userInteractionEvent, SYSTEM_EVENT_MAIN_MASK, true, K_FOREVER));
+		// Wait on system events, while awake also until LVGL's next deadline (if it has one at all)
+		timeTillNext = display_lvgl_service();
+		triggeredEvent = ((systemAwake && timeTillNext != LV_NO_TIMER_READY) ? k_event_wait(&userInteractionEvent, SYSTEM_EVENT_MAIN_MASK, true, K_MSEC(timeTillNext)) : k_event_wait(&userInteractionEvent, SYSTEM_EVENT_MAIN_MASK, true, K_FOREVER));
+		if (triggeredEvent & (SYSTEM_EVENT_SINGLE_TAP | SYSTEM_EVENT_DOUBLE_TAP)) traceMark(TRACE_TAP_WAKE);
 		
 		// If we are asleep, don't wake up on single taps, just ignore
 		if (!systemAwake && (triggeredEvent & SYSTEM_EVENT_SINGLE_TAP))
@@ -200,6 +252,7 @@ int main(void)
 				systemAwake = true;
 				display_wake();
 			}
+			traceMark(TRACE_TAP_HANDLED);
 
 			// Always start/reset timer on user interaction
 			k_timer_start(&systemSleepTimer, K_SECONDS(5), K_SECONDS(5));
@@ -213,11 +266,24 @@ int main(void)
 			{
 				display_switch_screen(SCREEN_ACTIVE);
 			}
+			else if (triggeredEvent & SYSTEM_EVENT_TIME_UPDATE)
+			{
+				// Keep the always-on time current, nothing else is drawn while asleep
+				display_always_on_update();
+			}
 		}
 		
+		if (triggeredEvent & SYSTEM_EVENT_VSYNC)
+		{
+			// Panel is starting a refresh while we animate, draw the next frame right away
+			if (systemAwake) display_handle_vsync();
+		}
+
 		if (triggeredEvent & SYSTEM_EVENT_TIMEOUT)
 		{
 			// Sleep timer expired, need to go into sleep
+			// Taps of this awake window are all drawn by now, report them before the sleep redraw
+			tracePrintReport();
 			systemAwake = false;
 			display_sleep();
 		}
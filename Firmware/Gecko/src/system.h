@@ -24,7 +24,8 @@
 #define SYSTEM_EVENT_TIMEOUT            0x04
 #define SYSTEM_EVENT_TIME_UPDATE        0x08
 #define SYSTEM_EVENT_NEW_NOTIFICATION   0x10
-#define SYSTEM_EVENT_MAIN_MASK          0x1F // 0b'11111
+#define SYSTEM_EVENT_VSYNC              0x20 // Only posted while the display is animating
+#define SYSTEM_EVENT_MAIN_MASK          0x3F // 0b'111111
 
 /* Generic Device Labels */
 #define PWM_DEVICE_LABEL        DT_NODELABEL(pwm0)
@@ -60,6 +61,13 @@
 #define DISPLAY_START_BRIGHTNESS    60 // %
 #define BRIGHTNESS_STEP             20 // %
 
+/* Always-on Display */
+// When the sleep timeout hits, keep a dim band with the time lit instead of blanking the panel
+#define ALWAYS_ON_ENABLED           1
+#define ALWAYS_ON_BRIGHTNESS        10  // %
+#define ALWAYS_ON_BAND_START_ROW    100 // Panel rows kept lit, everything outside is driven black
+#define ALWAYS_ON_BAND_END_ROW      139
+
 #if __DEVELOPMENT_BOARD__
     #define LCD_RESET_PIN           19 // P0.19
     #define LCD_CS_PIN              22 // P0.22
@@ -0,0 +1,194 @@
+#include <string.h>
+
+#include "system.h"
+#include "trace.h"
+
+#define TRACE_RING_SIZE 256 // About 9 marks per tap, so the last couple dozen taps
+
+// Stages a tap is broken down into, single and double taps share the posted stage
+#define STAGE_IRQ       0
+#define STAGE_STATUS    1
+#define STAGE_POSTED    2
+#define STAGE_WAKE      3
+#define STAGE_HANDLED   4
+#define STAGE_FLUSH     5
+#define STAGE_RENDER    6
+#define STAGE_PHOTON    7
+#define STAGE_COUNT     8
+#define STAGE_ALL       (BIT(STAGE_COUNT) - 1)
+
+typedef struct {
+	uint32_t cycles;
+	uint8_t point;
+} TraceEntry;
+
+typedef struct {
+	uint32_t at[STAGE_COUNT];
+	uint8_t seen;
+	bool isDouble;
+} TapEvent;
+
+static const uint8_t pointStage[TRACE_POINT_COUNT] = {
+	[TRACE_TAP_IRQ] = STAGE_IRQ,
+	[TRACE_TAP_STATUS] = STAGE_STATUS,
+	[TRACE_TAP_SINGLE] = STAGE_POSTED,
+	[TRACE_TAP_DOUBLE] = STAGE_POSTED,
+	[TRACE_TAP_WAKE] = STAGE_WAKE,
+	[TRACE_TAP_HANDLED] = STAGE_HANDLED,
+	[TRACE_FLUSH_BEGIN] = STAGE_FLUSH,
+	[TRACE_RENDER_DONE] = STAGE_RENDER,
+	[TRACE_PHOTON] = STAGE_PHOTON,
+};
+
+// Column names, each is the time taken to reach that stage from the one before
+static const char* stageNames[STAGE_COUNT] = {
+	"total", "read", "post", "wake", "handle", "flush", "render", "photon"
+};
+
+static TraceEntry traceRing[TRACE_RING_SIZE];
+static uint16_t traceHead = 0;
+static uint16_t traceCount = 0;
+static struct k_spinlock traceLock;
+static bool traceFrozen = false; // Set while the report reads the ring
+
+// Redraw stages only belong to a tap between it being handled and its photon, and only the first of each counts
+static bool tapInFlight = false;
+static uint8_t tapRedrawMarked;
+
+void traceMark(Trace_Point point)
+{
+	uint32_t now = k_cycle_get_32();
+	k_spinlock_key_t key = k_spin_lock(&traceLock);
+	uint8_t stage = pointStage[point];
+
+	if (traceFrozen)
+	{
+		k_spin_unlock(&traceLock, key);
+		return;
+	}
+
+	if (point == TRACE_TAP_IRQ)
+	{
+		tapInFlight = false;
+	}
+	else if (point == TRACE_TAP_HANDLED)
+	{
+		tapInFlight = true;
+		tapRedrawMarked = 0;
+	}
+	else if (stage > STAGE_HANDLED)
+	{
+		if (!tapInFlight || (tapRedrawMarked & BIT(stage)))
+		{
+			k_spin_unlock(&traceLock, key);
+			return;
+		}
+		tapRedrawMarked |= BIT(stage);
+		if (point == TRACE_PHOTON) tapInFlight = false;
+	}
+
+	traceRing[traceHead].cycles = now;
+	traceRing[traceHead].point = point;
+	traceHead = (traceHead + 1) % TRACE_RING_SIZE;
+	if (traceCount < TRACE_RING_SIZE) traceCount++;
+
+	k_spin_unlock(&traceLock, key);
+}
+
+bool traceTapInFlight(void)
+{
+	return tapInFlight;
+}
+
+static void tracePrintRow(const char* label, const uint32_t us[STAGE_COUNT])
+{
+	printf("  %-8s", label);
+	for (int stage = 1; stage < STAGE_COUNT; stage++) printf(" %8u", us[stage]);
+	printf(" %8u\n", us[0]);
+}
+
+void tracePrintReport(void)
+{
+	TapEvent event = {0};
+	uint32_t us[STAGE_COUNT];
+	uint32_t minUs[STAGE_COUNT];
+	uint32_t maxUs[STAGE_COUNT] = {0};
+	uint64_t sumUs[STAGE_COUNT] = {0};
+	uint16_t taps = 0;
+	uint16_t incomplete = 0;
+	uint16_t start, count;
+	char label[12];
+
+	k_spinlock_key_t key = k_spin_lock(&traceLock);
+	traceFrozen = true;
+	count = traceCount;
+	start = (traceHead + TRACE_RING_SIZE - traceCount) % TRACE_RING_SIZE;
+	k_spin_unlock(&traceLock, key);
+
+	memset(minUs, 0xFF, sizeof(minUs));
+	printf("Tap latency (us), time to reach each stage from the one before:\n");
+	printf("  %-8s", "tap");
+	for (int stage = 1; stage < STAGE_COUNT; stage++) printf(" %8s", stageNames[stage]);
+	printf(" %8s\n", stageNames[0]);
+
+	for (uint16_t i = 0; i < count; i++)
+	{
+		const TraceEntry* entry = &traceRing[(start + i) % TRACE_RING_SIZE];
+		uint8_t stage = pointStage[entry->point];
+
+		if (entry->point == TRACE_TAP_IRQ)
+		{
+			// A tap that had already been posted never made it to the panel. One that hadn't was
+			//  the first half of a double tap (or an orientation change), either way start over.
+			if (event.seen & BIT(STAGE_POSTED)) incomplete++;
+			event.seen = 0;
+		}
+		else if (!(event.seen & BIT(STAGE_IRQ)) || (event.seen & BIT(stage)))
+		{
+			// The tail of a tap from before the ring starts, or a repeat
+			continue;
+		}
+
+		event.at[stage] = entry->cycles;
+		event.seen |= BIT(stage);
+		if (stage == STAGE_POSTED) event.isDouble = (entry->point == TRACE_TAP_DOUBLE);
+		if (stage != STAGE_PHOTON) continue;
+
+		if (event.seen != STAGE_ALL)
+		{
+			incomplete++;
+			event.seen = 0;
+			continue;
+		}
+
+		us[0] = k_cyc_to_us_floor32(event.at[STAGE_PHOTON] - event.at[STAGE_IRQ]);
+		for (int s = 1; s < STAGE_COUNT; s++) us[s] = k_cyc_to_us_floor32(event.at[s] - event.at[s - 1]);
+		for (int s = 0; s < STAGE_COUNT; s++)
+		{
+			minUs[s] = MIN(minUs[s], us[s]);
+			maxUs[s] = MAX(maxUs[s], us[s]);
+			sumUs[s] += us[s];
+		}
+		taps++;
+
+		snprintf(label, sizeof(label), "%u %s", taps, event.isDouble ? "double" : "single");
+		tracePrintRow(label, us);
+		event.seen = 0;
+	}
+
+	if (taps)
+	{
+		for (int s = 0; s < STAGE_COUNT; s++) us[s] = sumUs[s] / taps;
+		tracePrintRow("min", minUs);
+		tracePrintRow("avg", us);
+		tracePrintRow("max", maxUs);
+	}
+	printf("  %u taps, %u incomplete\n", taps, incomplete);
+
+	// Start over so the next report only covers new taps
+	key = k_spin_lock(&traceLock);
+	traceCount = 0;
+	tapInFlight = false;
+	traceFrozen = false;
+	k_spin_unlock(&traceLock, key);
+}
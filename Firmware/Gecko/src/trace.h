@@ -0,0 +1,40 @@
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include "system.h"
+
+/*
+    Tap to photon latency trace
+    Each stage a tap goes through marks a timestamp into a fixed ring in RAM, cheap enough for
+    interrupt context. tracePrintReport() groups the ring back into taps and prints how long every
+    stage took, per tap and as min/avg/max, then starts the ring over.
+
+    A tap that never reaches the panel (single taps while asleep, taps that change nothing) is
+    counted as incomplete and left out of the summary. For a double tap the time starts at the
+    second tap, the gap between the two is the user's.
+*/
+
+typedef enum {
+    TRACE_TAP_IRQ,          // BMA400 INT1 fired
+    TRACE_TAP_STATUS,       // tapsThread has read the interrupt status
+    TRACE_TAP_SINGLE,       // Single tap timer ran out and posted the event
+    TRACE_TAP_DOUBLE,       // Double tap posted
+    TRACE_TAP_WAKE,         // main() is back from k_event_wait with the tap
+    TRACE_TAP_HANDLED,      // display_handle_tap() (or the wake up) is done
+    TRACE_FLUSH_BEGIN,      // First gc9a01_write() of the redraw starts sending
+    TRACE_RENDER_DONE,      // LVGL finished the refresh
+    TRACE_PHOTON,           // Last byte of the refresh is off the wire
+    TRACE_POINT_COUNT
+} Trace_Point;
+
+#ifdef CONFIG_GECKO_TAP_TRACE
+void traceMark(Trace_Point point);
+bool traceTapInFlight(void);
+void tracePrintReport(void);
+#else
+static inline void traceMark(Trace_Point point) {}
+static inline bool traceTapInFlight(void) { return false; }
+static inline void tracePrintReport(void) {}
+#endif
+
+#endif // __TRACE_H__
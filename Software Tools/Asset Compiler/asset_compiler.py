@@ -0,0 +1,290 @@
+"""
+Asset compiler for the watch's LVGL images.
+
+Turns a PNG (or an RGB565 C array already in the firmware) into a C image descriptor in one of
+these formats:
+    true        RGB565, what LVGL draws fastest but 2 bytes/pixel
+    indexed4    LVGL's built-in 16 color palette format, 0.5 bytes/pixel
+    indexed8    LVGL's built-in 256 color palette format, 1 byte/pixel
+    alpha4      LVGL's built-in alpha-only format (recolor it with img_recolor), 0.5 bytes/pixel
+    alpha8      As alpha4 with 1 byte/pixel
+    rle         Palette + run length encoded rows, decoded line by line by asset_decoder.c
+    auto        Smallest of the lossless ones for the image (the default)
+
+Usage:
+    python asset_compiler.py sloth.png img_sloth -o sloth.c
+    python asset_compiler.py --c-array assets.c:img_sloth_map --size 100x100 img_sloth -o sloth.c
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+# lv_img_cf_t values (LVGL v8)
+LV_IMG_CF_TRUE_COLOR = 4
+LV_IMG_CF_TRUE_COLOR_ALPHA = 5
+LV_IMG_CF_INDEXED_4BIT = 9
+LV_IMG_CF_INDEXED_8BIT = 10
+LV_IMG_CF_ALPHA_4BIT = 13
+LV_IMG_CF_ALPHA_8BIT = 14
+LV_IMG_CF_USER_ENCODED_0 = 24
+
+CF_NAMES = {
+    LV_IMG_CF_TRUE_COLOR: "LV_IMG_CF_TRUE_COLOR",
+    LV_IMG_CF_TRUE_COLOR_ALPHA: "LV_IMG_CF_TRUE_COLOR_ALPHA",
+    LV_IMG_CF_INDEXED_4BIT: "LV_IMG_CF_INDEXED_4BIT",
+    LV_IMG_CF_INDEXED_8BIT: "LV_IMG_CF_INDEXED_8BIT",
+    LV_IMG_CF_ALPHA_4BIT: "LV_IMG_CF_ALPHA_4BIT",
+    LV_IMG_CF_ALPHA_8BIT: "LV_IMG_CF_ALPHA_8BIT",
+    LV_IMG_CF_USER_ENCODED_0: "LV_IMG_CF_USER_ENCODED_0",
+}
+
+# Must match asset_decoder.h
+ASSET_FORMAT_PALETTE_RLE = 1
+ASSET_FLAG_ALPHA = 0x01
+RLE_RUN_FLAG = 0x80
+RLE_MAX_COUNT = 128
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("PNG input needs Pillow (pip install pillow)")
+    image = Image.open(path).convert("RGBA")
+    return image.width, image.height, list(image.getdata())
+
+
+def load_c_array(spec, size):
+    """ Read an RGB565 (little endian) image out of a C array, e.g. assets.c:img_sloth_map """
+    path, name = spec.rsplit(":", 1)
+    width, height = (int(v) for v in size.lower().split("x"))
+    source = open(path, "r").read()
+    match = re.search(r"^\s*(?:const\s+)?uint8_t\s+" + re.escape(name) + r"\s*\[\s*\]\s*=\s*\{(.*?)\};", source, re.S | re.M)
+    if not match:
+        sys.exit(f"{name} not found in {path}")
+    values = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", match.group(1))]
+    if len(values) != width * height * 2:
+        sys.exit(f"{name} has {len(values)} bytes, {width}x{height} RGB565 needs {width * height * 2}")
+
+    pixels = []
+    for i in range(0, len(values), 2):
+        rgb565 = values[i] | (values[i + 1] << 8)
+        red = (rgb565 >> 11) & 0x1F
+        green = (rgb565 >> 5) & 0x3F
+        blue = rgb565 & 0x1F
+        pixels.append(((red * 255 + 15) // 31, (green * 255 + 31) // 63, (blue * 255 + 15) // 31, 255))
+    return width, height, pixels
+
+
+def rgb565(pixel, swap):
+    value = ((pixel[0] >> 3) << 11) | ((pixel[1] >> 2) << 5) | (pixel[2] >> 3)
+    return struct.pack(">H" if swap else "<H", value)
+
+
+def build_palette(pixels, max_colors):
+    """ Exact palette or None if the image has more colors than fit """
+    palette = []
+    index = {}
+    for pixel in pixels:
+        if pixel not in index:
+            if len(palette) == max_colors:
+                return None, None
+            index[pixel] = len(palette)
+            palette.append(pixel)
+    return palette, [index[p] for p in pixels]
+
+
+def quantize(width, height, pixels, colors):
+    """ Lossy fallback for images with too many colors, needs Pillow """
+    try:
+        from PIL import Image
+    except ImportError:
+        return None, None
+    image = Image.new("RGBA", (width, height))
+    image.putdata(pixels)
+    quantized = image.quantize(colors=colors, dither=Image.Dither.NONE).convert("RGBA")
+    return build_palette(list(quantized.getdata()), colors)
+
+
+def pack_rows(values, width, height, bpp):
+    """ Pack bpp wide values MSB first, every row starting on a byte """
+    data = bytearray()
+    for y in range(height):
+        byte = 0
+        bits = 0
+        for x in range(width):
+            byte = (byte << bpp) | values[y * width + x]
+            bits += bpp
+            if bits == 8:
+                data.append(byte)
+                byte = 0
+                bits = 0
+        if bits:
+            data.append(byte << (8 - bits))
+    return data
+
+
+def encode_true(width, height, pixels, swap):
+    has_alpha = any(p[3] != 255 for p in pixels)
+    data = bytearray()
+    for pixel in pixels:
+        data += rgb565(pixel, swap)
+        if has_alpha:
+            data.append(pixel[3])
+    return (LV_IMG_CF_TRUE_COLOR_ALPHA if has_alpha else LV_IMG_CF_TRUE_COLOR), data
+
+
+def encode_indexed(width, height, palette, indices, bpp):
+    data = bytearray()
+    for i in range(1 << bpp):
+        red, green, blue, alpha = palette[i] if i < len(palette) else (0, 0, 0, 0)
+        data += bytes((blue, green, red, alpha)) # lv_color32_t
+    data += pack_rows(indices, width, height, bpp)
+    return (LV_IMG_CF_INDEXED_4BIT if bpp == 4 else LV_IMG_CF_INDEXED_8BIT), data
+
+
+def encode_alpha(width, height, pixels, bpp):
+    # Images without transparency use darkness as coverage, so black on white art works too
+    has_alpha = any(p[3] != 255 for p in pixels)
+    levels = (1 << bpp) - 1
+    values = []
+    for pixel in pixels:
+        coverage = pixel[3] if has_alpha else 255 - (pixel[0] * 299 + pixel[1] * 587 + pixel[2] * 114) // 1000
+        values.append((coverage * levels + 127) // 255)
+    return (LV_IMG_CF_ALPHA_4BIT if bpp == 4 else LV_IMG_CF_ALPHA_8BIT), pack_rows(values, width, height, bpp)
+
+
+def rle_row(indices):
+    """ Packets: 0x80 | (n - 1) followed by one index repeats it n times,
+        n - 1 (< 0x80) followed by n indices copies them """
+    out = bytearray()
+    literal = []
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < RLE_MAX_COUNT:
+            run += 1
+        if run >= 3 or (run == 2 and not literal):
+            if literal:
+                out.append(len(literal) - 1)
+                out += bytes(literal)
+                literal = []
+            out.append(RLE_RUN_FLAG | (run - 1))
+            out.append(indices[i])
+            i += run
+        else:
+            literal.append(indices[i])
+            i += 1
+            if len(literal) == RLE_MAX_COUNT:
+                out.append(len(literal) - 1)
+                out += bytes(literal)
+                literal = []
+    if literal:
+        out.append(len(literal) - 1)
+        out += bytes(literal)
+    return out
+
+
+def encode_rle(width, height, palette, indices):
+    has_alpha = any(p[3] != 255 for p in palette)
+    rows = bytearray()
+    offsets = []
+    for y in range(height):
+        offsets.append(len(rows))
+        rows += rle_row(indices[y * width:(y + 1) * width])
+
+    data = bytearray(struct.pack("<BBH", ASSET_FORMAT_PALETTE_RLE, ASSET_FLAG_ALPHA if has_alpha else 0, len(palette)))
+    for red, green, blue, alpha in palette:
+        data += bytes((blue, green, red, alpha))
+    for offset in offsets:
+        data += struct.pack("<I", offset)
+    data += rows
+    return LV_IMG_CF_USER_ENCODED_0, data
+
+
+def compile_asset(width, height, pixels, fmt, swap):
+    candidates = {}
+
+    if fmt in ("true", "auto"):
+        candidates["true"] = encode_true(width, height, pixels, swap)
+    if fmt in ("alpha4", "alpha8"):
+        candidates[fmt] = encode_alpha(width, height, pixels, 4 if fmt == "alpha4" else 8)
+
+    if fmt in ("indexed4", "indexed8", "rle", "auto"):
+        lossless = True
+        for colors, name in ((16, "indexed4"), (256, "indexed8")):
+            if fmt not in (name, "auto") and not (name == "indexed8" and fmt == "rle"):
+                continue
+            palette, indices = build_palette(pixels, colors)
+            if palette is None:
+                if fmt == "auto":
+                    continue
+                palette, indices = quantize(width, height, pixels, colors)
+                if palette is None:
+                    sys.exit(f"Image has more than {colors} colors, install Pillow to quantize it")
+                lossless = False
+                print(f"Warning: quantized to {colors} colors", file=sys.stderr)
+            if name == "indexed4" or fmt != "rle":
+                candidates[name] = encode_indexed(width, height, palette, indices, 4 if name == "indexed4" else 8)
+            if name == "indexed8" and fmt in ("rle", "auto"):
+                candidates["rle"] = encode_rle(width, height, palette, indices)
+        if fmt == "auto" and not lossless:
+            candidates = {"true": candidates["true"]}
+
+    name = min(candidates, key=lambda n: len(candidates[n][1])) if fmt == "auto" else fmt
+    return name, candidates[name]
+
+
+def write_c(path, symbol, source, fmt, width, height, cf, data):
+    lines = [
+        f"// Generated by asset_compiler.py from {source}, {fmt} ({len(data)} bytes, {width * height * 2} as RGB565)",
+        f"const uint8_t {symbol}_map[] = {{",
+    ]
+    for i in range(0, len(data), 24):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 24]) + ",")
+    lines += [
+        "};",
+        "",
+        f"const lv_img_dsc_t {symbol}_desc = {{",
+        f"    .header = {{.cf = {CF_NAMES[cf]}, .w = {width}, .h = {height}}},",
+        f"    .data_size = sizeof({symbol}_map),",
+        f"    .data = {symbol}_map,",
+        "};",
+        "",
+    ]
+    with open(path, "w") as file:
+        file.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile images into LVGL C image descriptors")
+    parser.add_argument("image", nargs="?", help="PNG to convert")
+    parser.add_argument("symbol", help="C name, generates <symbol>_map and <symbol>_desc")
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    parser.add_argument("-f", "--format", default="auto",
+                        choices=("auto", "true", "indexed4", "indexed8", "alpha4", "alpha8", "rle"))
+    parser.add_argument("--c-array", help="Read RGB565 pixels from FILE:ARRAY_NAME instead of a PNG")
+    parser.add_argument("--size", help="WxH of the --c-array image")
+    parser.add_argument("--no-swap", action="store_true", help="True color without CONFIG_LV_COLOR_16_SWAP")
+    args = parser.parse_args()
+
+    if args.c_array:
+        if not args.size:
+            parser.error("--c-array needs --size")
+        width, height, pixels = load_c_array(args.c_array, args.size)
+        source = args.c_array
+    elif args.image:
+        width, height, pixels = load_png(args.image)
+        source = args.image
+    else:
+        parser.error("give a PNG or --c-array")
+
+    fmt, (cf, data) = compile_asset(width, height, pixels, args.format, not args.no_swap)
+    write_c(args.output, args.symbol, source, fmt, width, height, cf, data)
+    print(f"{args.symbol}: {width}x{height} {fmt}, {len(data)} bytes ({100 * len(data) // (width * height * 2)}% of RGB565)")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,6 +1,7 @@
 from PIL import Image, ImageDraw
 
 # Replicated C implementation should give the desired image ouput as a text file of hex values
+# main writes image.png itself now, image.txt is only written when it is run with --txt
 # Each pixel is represented in 5-6-5 color, so 2 bytes/pixel
 def convertArrayToImage():
     with open("./image.txt", "r") as file:
@@ -1,4 +1,3 @@
 @echo off
 make
-.\bin\main
-python .\GeckoImage.py
\ No newline at end of file
+.\bin\main
\ No newline at end of file
@@ -1,17 +1,83 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "GC9A01A.h"
+#include "GC9A01A_emu.h"
 
-#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+/*
+    Host copy of Firmware/Gecko/src/Peripherals/Display/GC9A01A.c. The command and pin sequence is
+    kept the same as the firmware's, only the Zephyr GPIO and SPI calls below are swapped for the
+    emulated panel in GC9A01A_emu.c. Delays are skipped.
+*/
 
-uint8_t screenBuffer[SCREEN_BUFFER_LENGTH];
+#define LCD_CS_PIN 0
+#define LCD_DC_PIN 1
 
-static uint16_t currentX = 0;
-static uint16_t currentY = 0;
-static uint16_t currentXMax = 239;
-static uint16_t currentYMax = 239;
-static uint16_t currentXMin = 0;
-static uint16_t currentYMin = 0;
+static int gpio_pin_set(int pin, int value)
+{
+    if (pin == LCD_CS_PIN) GC9A01A_emu_cs(value);
+    else GC9A01A_emu_dc(value);
+    return 0;
+}
+
+static int spi_write(const uint8_t* data, int len)
+{
+    GC9A01A_emu_write(data, len);
+    return 0;
+}
+
+static GC9A01A_init_cmd_t GC9A01A_init_cmds[] = {
+    {0xEF, {0}, 0, 0},
+    {0xEB, {0x14}, 1, 0},
+    {0xFE, {0}, 0, 0},
+    {0xEF, {0}, 0, 0},
+    {0xEB, {0x14}, 1, 0},
+    {0x84, {0x40}, 1, 0},
+    {0x85, {0xFF}, 1, 0},
+    {0x86, {0xFF}, 1, 0},
+    {0x87, {0xFF}, 1, 0},
+    {0x88, {0x0A}, 1, 0},
+    {0x89, {0x21}, 1, 0},
+    {0x8A, {0x00}, 1, 0},
+    {0x8B, {0x80}, 1, 0},
+    {0x8C, {0x01}, 1, 0},
+    {0x8D, {0x01}, 1, 0},
+    {0x8E, {0xFF}, 1, 0},
+    {0x8F, {0xFF}, 1, 0},
+    {0xB6, {0x00, 0x00}, 2, 0},
+    {0x36, {0x48}, 1, 0}, // This one might need to be changed if it's being weird
+    {0x3A, {0x05}, 1, 0},
+    {0x90, {0x08, 0x08, 0x08, 0x08}, 4, 0},
+    {0xBD, {0x06}, 1, 0},
+    {0xBC, {0x00}, 1, 0},
+    {0xFF, {0x60, 0x01, 0x04}, 3, 0},
+    {0xC3, {0x13}, 1, 0},
+    {0xC4, {0x13}, 1, 0},
+    {0xC9, {0x22}, 1, 0},
+    {0xBE, {0x11}, 1, 0},
+    {0xE1, {0x10, 0x0E}, 2, 0},
+    {0xDF, {0x21, 0x0C, 0x02}, 3, 0},
+    {0xF0, {0x45, 0x09, 0x08, 0x08, 0x26, 0x2A}, 6, 0},
+    {0xF1, {0x43, 0x70, 0x72, 0x36, 0x37, 0x6F}, 6, 0},
+    {0xF2, {0x45, 0x09, 0x08, 0x08, 0x26, 0x2A}, 6, 0},
+    {0xF3, {0x43, 0x70, 0x72, 0x36, 0x37, 0x6F}, 6, 0},
+    {0xED, {0x1B, 0x0B}, 2, 0},
+    {0xAE, {0x77}, 1, 0},
+    {0xCD, {0x63}, 1, 0},
+    {0x70, {0x07, 0x07, 0x04, 0x0E, 0x0F, 0x09, 0x07, 0x08, 0x03}, 9, 0},
+    {0xE8, {0x34}, 1, 0},
+    {0x62, {0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70}, 12, 0},
+    {0x63, {0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70}, 12, 0},
+    {0x64, {0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07}, 7, 0},
+    {0x66, {0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00}, 10, 0},
+    {0x67, {0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98}, 10, 0},
+    {0x74, {0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00}, 7, 0},
+    {0x98, {0x3E, 0x07}, 2, 0},
+    {0x35, {0}, 0, 0},
+    {0x21, {0}, 0, 0},
+    {0x11, {0}, 0, 120},
+    {0x29, {0}, 0, 20},
+    {0x00, {0}, 0xFF, 20} // End of sequence command
+};
 
 static uint8_t map(uint8_t x, uint8_t in_min, uint8_t in_max, uint8_t out_min, uint8_t out_max)
 {
@@ -38,55 +104,122 @@ uint16_t lcd_RGB(uint8_t red, uint8_t green, uint8_t blue)
     return color;
 }
 
+int GC9A01A_cmd(uint8_t cmd)
+{
+    gpio_pin_set(LCD_DC_PIN, 0);
+    return spi_write(&cmd, 1);
+}
+
+int GC9A01A_data(uint8_t* data, int len)
+{
+    gpio_pin_set(LCD_DC_PIN, 1);
+    return spi_write(data, len);
+}
+
+int GC9A01A_init(void)
+{
+    int error = 0;
+    int cmd = 0;
+
+    gpio_pin_set(LCD_CS_PIN, 1);
+    while (GC9A01A_init_cmds[cmd].databytes != 0xff)
+    {
+        error += gpio_pin_set(LCD_CS_PIN, 0);
+        error += GC9A01A_cmd(GC9A01A_init_cmds[cmd].cmd);
+        if (GC9A01A_init_cmds[cmd].databytes > 0)
+        {
+            error += GC9A01A_data(GC9A01A_init_cmds[cmd].data, GC9A01A_init_cmds[cmd].databytes);
+        }
+        error += gpio_pin_set(LCD_CS_PIN, 1);
+        cmd++;
+    }
+    return error;
+}
+
 int GC9A01A_fill_screen(uint16_t rgb)
 {
-    for (int i = 0; i < SCREEN_BUFFER_LENGTH; i+=2)
+    unsigned int i,j;
+    uint8_t temp[2];
+    GC9A01A_set_position(0, 239, 0, 239);
+    gpio_pin_set(LCD_CS_PIN, 0);
+    for (i=0; i < 240; i++)
     {
-        screenBuffer[i] = rgb >> 8;
-        screenBuffer[i + 1] = rgb & 0xFF;
+        for (j=0; j<240; j++)
+        {
+            temp[0] = rgb >> 8;
+            temp[1] = rgb & 0xFF;
+            GC9A01A_data(temp, 2);
+        }
     }
+    gpio_pin_set(LCD_CS_PIN, 1);
     return 0;
 }
 
 void GC9A01A_set_position(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Yend)
 {
-    currentXMax = MIN(Xend, 239);
-    currentYMax = MIN(Yend, 239);
-    currentXMin = MIN(Xstart, 239);
-    currentYMin = MIN(Ystart, 239);    
+    uint8_t temp[4];
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x2a);
+    temp[0] = Xstart >> 8;
+    temp[1] = Xstart;
+    temp[2] = Xend >> 8;
+    temp[3] = Xend;
+    GC9A01A_data(temp, 4);
+    gpio_pin_set(LCD_CS_PIN, 1);
+
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x2b);
+    temp[0] = Ystart >> 8;
+    temp[1] = Ystart;
+    temp[2] = Yend >> 8;
+    temp[3] = Yend;
+    GC9A01A_data(temp, 4);
+    gpio_pin_set(LCD_CS_PIN, 1);
 
-    currentX = currentXMin;
-    currentY = currentYMin;
+    // Memory write command, this will reset the write pointer to the row and column just set
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x2C);
+    gpio_pin_set(LCD_CS_PIN, 1);
 }
 
 void GC9A01A_write(uint8_t* data, int len)
 {
-    //printf("Length: %d\n", len);
-    uint16_t currentIndexX = 2 * currentX;
-    while (len > 0)
-    {
-        // Need to write two bytes per pixel
-        screenBuffer[currentY * SCREEN_WIDTH * 2 + currentIndexX] = *data++;
-        currentIndexX++;
-        screenBuffer[currentY * SCREEN_WIDTH * 2 + currentIndexX] = *data++;
-        currentIndexX++;
-
-        currentX++;
-        if (currentX > currentXMax) 
-        {
-            //printf("Row Done, y: %d x: %d\n", currentY, currentX);
-            currentX = currentXMin;
-            currentIndexX = 2 * currentX;
-            currentY++;
-        }
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x2C);
+    GC9A01A_data(data, len);
+    gpio_pin_set(LCD_CS_PIN, 1);
+}
 
-        if (currentY > currentYMax)
-        {
-            // If we overflow the Y we are done
-            //printf("Exceeded Y range: %d\n", currentY);
-            currentY = currentYMin;
-            return;
-        }
-        len-=2;
-    }
+// The firmware overlaps each chunk with the next, here every write completes straight away
+void GC9A01A_stream_begin(void)
+{
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x2C);
+    gpio_pin_set(LCD_DC_PIN, 1);
+}
+
+int GC9A01A_stream(const uint8_t* data, int len)
+{
+    return spi_write(data, len);
+}
+
+void GC9A01A_stream_end(void)
+{
+    gpio_pin_set(LCD_CS_PIN, 1);
+}
+
+void GC9A01A_sleep(void)
+{
+    // Sleep command is 0x10
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x10);
+    gpio_pin_set(LCD_CS_PIN, 1);
+}
+
+void GC9A01A_wake(void)
+{
+    // Sleep out command is 0x11
+    gpio_pin_set(LCD_CS_PIN, 0);
+    GC9A01A_cmd(0x11);
+    gpio_pin_set(LCD_CS_PIN, 1);
 }
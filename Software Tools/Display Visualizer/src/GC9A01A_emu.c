@@ -0,0 +1,436 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "GC9A01A_emu.h"
+#include "png.h"
+
+// Commands the emulator acts on, everything else is counted and its parameters skipped
+#define CMD_PTLON       0x12
+#define CMD_NORON       0x13
+#define CMD_CASET       0x2A
+#define CMD_RASET       0x2B
+#define CMD_RAMWR       0x2C
+#define CMD_VSCRDEF     0x33
+#define CMD_VSCRSADD    0x37
+#define CMD_COLMOD      0x3A
+#define CMD_MEM_WR_CONT 0x3C
+
+#define COLMOD_12_BIT   0x03
+#define COLMOD_16_BIT   0x05
+#define COLMOD_18_BIT   0x06
+
+#define SCALE_4_TO_6(v) (((v) << 2) | ((v) >> 2))
+
+#define NO_COMMAND      -1
+#define ANY_PARAMS      -1
+
+// 6 bits per channel like the controller's own GRAM, so every interface format is stored exactly
+static uint8_t gram[GC9A01A_EMU_HEIGHT][GC9A01A_EMU_WIDTH][3];
+
+static int chip_select = 1;
+static int data_cmd = 1;
+
+static int command = NO_COMMAND;
+static uint8_t params[6];
+static int param_count;
+static int params_expected;
+
+static uint16_t window_x_start, window_x_end, window_y_start, window_y_end;
+static uint16_t pointer_x, pointer_y;
+static uint8_t colmod;
+
+// Pixels can be split across SPI writes, the bytes of one in progress wait here
+static uint8_t pixel_bytes[3];
+static int pixel_fill;
+
+static bool scroll_enabled;
+static uint16_t scroll_top, scroll_rows, scroll_start;
+
+static GC9A01A_emu_stats_t stats;
+static int frame_count = 0;
+
+// Must match gc9a01_trace.h
+#define TRACE_VERSION       1
+#define TRACE_HEADER_SIZE   20
+#define TRACE_DATA_MAX      8
+#define TRACE_CMD           0x01
+#define TRACE_DATA          0x02
+#define TRACE_SIZE          (64 * 1024)
+
+static uint8_t trace_buf[TRACE_SIZE];
+static size_t trace_len;
+static uint32_t trace_dropped;
+static bool trace_active;
+static uint64_t trace_bits;     // Clocked out since the trace started
+static uint32_t trace_last_us;
+static int trace_last_cmd = NO_COMMAND;
+
+void GC9A01A_emu_reset(void)
+{
+    memset(gram, 0, sizeof(gram));
+    chip_select = 1;
+    data_cmd = 1;
+    command = NO_COMMAND;
+    param_count = 0;
+    params_expected = 0;
+    window_x_start = 0;
+    window_x_end = GC9A01A_EMU_WIDTH - 1;
+    window_y_start = 0;
+    window_y_end = GC9A01A_EMU_HEIGHT - 1;
+    pointer_x = 0;
+    pointer_y = 0;
+    colmod = 0x66; // Datasheet default, 18 bit
+    pixel_fill = 0;
+    scroll_enabled = false;
+    memset(&stats, 0, sizeof(stats));
+    frame_count = 0;
+}
+
+void GC9A01A_emu_cs(int level)
+{
+    if (chip_select && !level) stats.cs_assertions++;
+    chip_select = level;
+}
+
+void GC9A01A_emu_dc(int level)
+{
+    if (level != data_cmd) stats.dc_toggles++;
+    data_cmd = level;
+}
+
+static int params_for(uint8_t cmd)
+{
+    switch (cmd)
+    {
+        case CMD_CASET:
+        case CMD_RASET:     return 4;
+        case CMD_VSCRDEF:   return 6;
+        case CMD_VSCRSADD:  return 2;
+        case CMD_COLMOD:    return 1;
+        case CMD_PTLON:
+        case CMD_NORON:     return 0;
+        default:            return ANY_PARAMS; // Init sequence vendor commands and the like
+    }
+}
+
+static void store_pixel(uint8_t red, uint8_t green, uint8_t blue)
+{
+    gram[pointer_y][pointer_x][0] = red;
+    gram[pointer_y][pointer_x][1] = green;
+    gram[pointer_y][pointer_x][2] = blue;
+    stats.pixels++;
+
+    // Left to right, top to bottom, and back to the window start after its last pixel
+    if (++pointer_x > window_x_end)
+    {
+        pointer_x = window_x_start;
+        if (++pointer_y > window_y_end) pointer_y = window_y_start;
+    }
+}
+
+static void pixel_byte(uint8_t byte)
+{
+    pixel_bytes[pixel_fill++] = byte;
+
+    switch (colmod & 0x07)
+    {
+        case COLMOD_16_BIT:
+            if (pixel_fill < 2) return;
+            store_pixel(((pixel_bytes[0] >> 3) << 1) | (pixel_bytes[0] >> 7),
+                        ((pixel_bytes[0] & 0x07) << 3) | (pixel_bytes[1] >> 5),
+                        ((pixel_bytes[1] & 0x1F) << 1) | ((pixel_bytes[1] >> 4) & 0x01));
+            break;
+
+        case COLMOD_12_BIT:
+            // Two pixels in three bytes, R1G1 B1R2 G2B2
+            if (pixel_fill < 3) return;
+            store_pixel(SCALE_4_TO_6(pixel_bytes[0] >> 4), SCALE_4_TO_6(pixel_bytes[0] & 0x0F), SCALE_4_TO_6(pixel_bytes[1] >> 4));
+            store_pixel(SCALE_4_TO_6(pixel_bytes[1] & 0x0F), SCALE_4_TO_6(pixel_bytes[2] >> 4), SCALE_4_TO_6(pixel_bytes[2] & 0x0F));
+            break;
+
+        default:
+            // 18 bit, the top 6 bits of each byte
+            if (pixel_fill < 3) return;
+            store_pixel(pixel_bytes[0] >> 2, pixel_bytes[1] >> 2, pixel_bytes[2] >> 2);
+            break;
+    }
+    pixel_fill = 0;
+}
+
+static uint16_t param_be16(int index)
+{
+    return (params[index] << 8) | params[index + 1];
+}
+
+static void set_window(uint16_t* start, uint16_t* end, uint16_t limit)
+{
+    uint16_t new_start = param_be16(0);
+    uint16_t new_end = param_be16(2);
+
+    stats.windows++;
+    if (new_start > new_end || new_end >= limit)
+    {
+        stats.errors++;
+        if (new_end >= limit) new_end = limit - 1;
+        if (new_start > new_end) new_start = new_end;
+    }
+    *start = new_start;
+    *end = new_end;
+}
+
+// The last parameter of a command arrived
+static void command_complete(void)
+{
+    switch (command)
+    {
+        case CMD_CASET:
+            set_window(&window_x_start, &window_x_end, GC9A01A_EMU_WIDTH);
+            break;
+
+        case CMD_RASET:
+            set_window(&window_y_start, &window_y_end, GC9A01A_EMU_HEIGHT);
+            break;
+
+        case CMD_COLMOD:
+            colmod = params[0];
+            break;
+
+        case CMD_VSCRDEF:
+            if (param_be16(0) + param_be16(2) + param_be16(4) != GC9A01A_EMU_HEIGHT || param_be16(2) == 0)
+            {
+                stats.errors++;
+                break;
+            }
+            scroll_top = param_be16(0);
+            scroll_rows = param_be16(2);
+            scroll_start = scroll_top;
+            scroll_enabled = true;
+            break;
+
+        case CMD_VSCRSADD:
+            scroll_start = param_be16(0);
+            if (scroll_enabled && (scroll_start < scroll_top || scroll_start >= scroll_top + scroll_rows)) stats.errors++;
+            break;
+    }
+}
+
+static void command_byte(uint8_t cmd)
+{
+    // The one before should have had all its parameters by now
+    if (params_expected != ANY_PARAMS && param_count < params_expected) stats.errors++;
+
+    stats.commands++;
+    command = cmd;
+    param_count = 0;
+    params_expected = params_for(cmd);
+    pixel_fill = 0;
+
+    switch (cmd)
+    {
+        case CMD_RAMWR:
+            stats.ram_writes++;
+            pointer_x = window_x_start;
+            pointer_y = window_y_start;
+            break;
+
+        case CMD_MEM_WR_CONT:
+            stats.ram_write_continues++;
+            break;
+
+        case CMD_PTLON:
+        case CMD_NORON:
+            // Both leave vertical scrolling mode
+            scroll_enabled = false;
+            break;
+    }
+}
+
+static void data_byte(uint8_t byte)
+{
+    if (command == CMD_RAMWR || command == CMD_MEM_WR_CONT)
+    {
+        pixel_byte(byte);
+        return;
+    }
+
+    if (command == NO_COMMAND || (params_expected != ANY_PARAMS && param_count >= params_expected))
+    {
+        stats.errors++;
+        return;
+    }
+
+    if (param_count < (int)sizeof(params)) params[param_count] = byte;
+    param_count++;
+    if (param_count == params_expected) command_complete();
+}
+
+static size_t trace_varint(uint8_t* dst, uint32_t value)
+{
+    size_t len = 0;
+
+    while (value >= 0x80)
+    {
+        dst[len++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    dst[len++] = value;
+
+    return len;
+}
+
+// One record stamped at the current wire time, dropped along with everything after it once full
+static void trace_put(uint8_t type, const uint8_t* payload, size_t len)
+{
+    uint32_t now = (uint32_t)(trace_bits * 1000000 / GC9A01A_EMU_SPI_HZ);
+
+    if (trace_dropped || trace_len + 1 + 5 + len > sizeof(trace_buf))
+    {
+        trace_dropped++;
+        return;
+    }
+
+    trace_buf[trace_len++] = type;
+    trace_len += trace_varint(&trace_buf[trace_len], now - trace_last_us);
+    memcpy(&trace_buf[trace_len], payload, len);
+    trace_len += len;
+    trace_last_us = now;
+}
+
+static void trace_write(const uint8_t* data, int len)
+{
+    uint8_t payload[5 + TRACE_DATA_MAX];
+    size_t size;
+
+    if (!data_cmd)
+    {
+        for (int i = 0; i < len; i++)
+        {
+            trace_last_cmd = data[i];
+            trace_put(TRACE_CMD, &data[i], 1);
+        }
+    }
+    else
+    {
+        // Parameters are kept, pixels only by their size, like the firmware's recorder
+        size = trace_varint(payload, len);
+        if (trace_last_cmd != CMD_RAMWR && trace_last_cmd != CMD_MEM_WR_CONT && len <= TRACE_DATA_MAX)
+        {
+            memcpy(&payload[size], data, len);
+            size += len;
+        }
+        trace_put(TRACE_DATA, payload, size);
+    }
+    trace_bits += (uint64_t)len * 8;
+}
+
+static void put_le32(uint8_t* dst, uint32_t value)
+{
+    for (int i = 0; i < 4; i++) dst[i] = value >> (8 * i);
+}
+
+void GC9A01A_emu_trace_start(void)
+{
+    trace_len = TRACE_HEADER_SIZE;
+    trace_dropped = 0;
+    trace_bits = 0;
+    trace_last_us = 0;
+    trace_last_cmd = NO_COMMAND;
+    trace_active = true;
+}
+
+int GC9A01A_emu_trace_save(const char* path)
+{
+    FILE* file;
+    size_t written;
+
+    memcpy(trace_buf, "GTRC", 4);
+    trace_buf[4] = TRACE_VERSION;
+    memset(&trace_buf[5], 0, 3);
+    put_le32(&trace_buf[8], GC9A01A_EMU_SPI_HZ);
+    put_le32(&trace_buf[12], trace_len - TRACE_HEADER_SIZE);
+    put_le32(&trace_buf[16], trace_dropped);
+
+    file = fopen(path, "wb");
+    if (!file) return -1;
+    written = fwrite(trace_buf, 1, trace_len, file);
+    fclose(file);
+
+    printf("Trace -> %s, %u bytes, %u dropped\n", path, (uint32_t)trace_len, trace_dropped);
+    return written == trace_len ? 0 : -1;
+}
+
+void GC9A01A_emu_write(const uint8_t* data, int len)
+{
+    // The driver asked for it, the recorder sees it whether the panel is listening or not
+    if (trace_active) trace_write(data, len);
+
+    stats.transfers++;
+    if (chip_select)
+    {
+        // The panel isn't listening
+        stats.errors++;
+        return;
+    }
+
+    stats.bytes += len;
+    for (int i = 0; i < len; i++)
+    {
+        if (data_cmd) data_byte(data[i]);
+        else command_byte(data[i]);
+    }
+}
+
+uint16_t GC9A01A_emu_pixel(uint16_t x, uint16_t y)
+{
+    uint16_t row = y;
+
+    // Screen rows in the scroll area show GRAM from the start address on, wrapping inside the area
+    if (scroll_enabled && y >= scroll_top && y < scroll_top + scroll_rows)
+    {
+        row = scroll_top + (y - scroll_top + scroll_start - scroll_top) % scroll_rows;
+    }
+
+    return ((gram[row][x][0] >> 1) << 11) | (gram[row][x][1] << 5) | (gram[row][x][2] >> 1);
+}
+
+void GC9A01A_emu_get_stats(GC9A01A_emu_stats_t* out)
+{
+    *out = stats;
+}
+
+void GC9A01A_emu_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+int GC9A01A_emu_frame(const char* path)
+{
+    static uint8_t rgb[GC9A01A_EMU_WIDTH * GC9A01A_EMU_HEIGHT * 3];
+    uint8_t* out = rgb;
+    int err;
+
+    for (uint16_t y = 0; y < GC9A01A_EMU_HEIGHT; y++)
+    {
+        for (uint16_t x = 0; x < GC9A01A_EMU_WIDTH; x++)
+        {
+            uint16_t color = GC9A01A_emu_pixel(x, y);
+            uint8_t red = color >> 11, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+
+            *out++ = (red << 3) | (red >> 2);
+            *out++ = (green << 2) | (green >> 4);
+            *out++ = (blue << 3) | (blue >> 2);
+        }
+    }
+    err = png_write_rgb(path, rgb, GC9A01A_EMU_WIDTH, GC9A01A_EMU_HEIGHT);
+
+    printf("Frame %d -> %s%s\n", frame_count, path, err ? " (write failed)" : "");
+    printf("  %u bytes in %u transfers, %u us on the wire at %u MHz\n", stats.bytes, stats.transfers,
+           (uint32_t)((uint64_t)stats.bytes * 8 * 1000000 / GC9A01A_EMU_SPI_HZ), GC9A01A_EMU_SPI_HZ / 1000000);
+    printf("  %u commands (%u RAMWR, %u MEM_WR_CONT, %u CASET/RASET), %u DC toggles, %u CS assertions\n",
+           stats.commands, stats.ram_writes, stats.ram_write_continues, stats.windows, stats.dc_toggles, stats.cs_assertions);
+    printf("  %u pixels, %u errors\n", stats.pixels, stats.errors);
+
+    GC9A01A_emu_reset_stats();
+    frame_count++;
+    return err;
+}
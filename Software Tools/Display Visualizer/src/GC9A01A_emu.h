@@ -0,0 +1,60 @@
+#ifndef __GC9A01A_EMU_H
+#define __GC9A01A_EMU_H
+
+#include <stdint.h>
+
+/*
+    Host side GC9A01 panel. GC9A01A.c drives it through the same chip select, data/command pin and
+    SPI writes the firmware driver makes, and it decodes that byte stream the way the controller
+    would: CASET/RASET set the window, RAMWR and MEM_WR_CONT write pixels in the COLMOD format into
+    an 18 bit GRAM, VSCRDEF/VSCRSADD scroll the displayed rows. MADCTL is not modelled, frames come
+    out the way the driver addresses the panel.
+
+    Bus traffic is counted from one frame to the next so a driver change can be checked for both the
+    picture and what it costs on the wire.
+*/
+
+#define GC9A01A_EMU_WIDTH       240
+#define GC9A01A_EMU_HEIGHT      240
+#define GC9A01A_EMU_SPI_HZ      32000000 // gecko_development runs the display SPI at 32 MHz
+
+typedef struct {
+    uint32_t bytes;             // Everything clocked out, commands and data
+    uint32_t commands;
+    uint32_t transfers;         // SPI writes, each one is a separate DMA transaction on the nRF
+    uint32_t dc_toggles;
+    uint32_t cs_assertions;
+    uint32_t pixels;            // Pixels that landed in GRAM
+    uint32_t ram_writes;        // RAMWR
+    uint32_t ram_write_continues; // MEM_WR_CONT
+    uint32_t windows;           // CASET or RASET
+    uint32_t errors;            // Stray data, short parameter lists, backwards windows
+} GC9A01A_emu_stats_t;
+
+// Power on state: GRAM cleared, full window, 18 bit pixels, no scrolling
+void GC9A01A_emu_reset(void);
+
+// Bus side, called by GC9A01A.c where the firmware sets a pin or starts an SPI write
+void GC9A01A_emu_cs(int level);
+void GC9A01A_emu_dc(int level);
+void GC9A01A_emu_write(const uint8_t* data, int len);
+
+// Displayed pixel in 5-6-5, vertical scrolling applied
+uint16_t GC9A01A_emu_pixel(uint16_t x, uint16_t y);
+
+void GC9A01A_emu_get_stats(GC9A01A_emu_stats_t* stats);
+void GC9A01A_emu_reset_stats(void);
+
+// Write what the panel shows to a PNG and print the traffic since the last frame, returns 0 on success
+int GC9A01A_emu_frame(const char* path);
+
+/*
+    Bus trace in the firmware's CONFIG_GC9A01_TRACE format (drivers/display/gc9a01_trace.h), for
+    "Software Tools/Trace Replay". There is no CPU time on the host, each record is stamped with the
+    wire time at GC9A01A_EMU_SPI_HZ of everything before it, so the same drawing always gives the
+    same trace.
+*/
+void GC9A01A_emu_trace_start(void);
+int GC9A01A_emu_trace_save(const char* path);
+
+#endif
@@ -1,9 +1,21 @@
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
 #include "LCD.h"
 #include "GC9A01A.h"
 
+// Scaled glyphs are cached per size, keyed by character and color. Text is nearly always redrawn
+//  in the same few colors, so a screen of it mostly skips the scaling.
+typedef struct GLYPH_CACHE_ENTRY {
+  char character;
+  uint16_t color;
+  uint32_t last_used; // 0 while the slot is empty
+} GLYPH_CACHE_ENTRY;
+
 typedef struct CHAR_INFO {
-  uint8_t* buffer;
+  uint8_t* buffer;          // slots glyphs of width x height pixels, back to back
+  GLYPH_CACHE_ENTRY* cache;
+  uint8_t slots;
   uint8_t width;
   uint8_t height;
   uint8_t x_offset;
@@ -12,16 +24,39 @@ typedef struct CHAR_INFO {
   uint8_t max_row;
 } CHAR_INFO;
 
-static char char_extra_small_buffer[7 * 8 * 2];      // 7x8   pixels (1 pixel -> 1x1) -> 34 column, 30 row, 1 x_off, 0 y_off
-static char char_small_buffer[7 * 8 * 2 * 4];        // 14x16 pixels (1 pixel -> 2x2) -> 17 column, 15 row, 1 x_off, 0 y_off
-static char char_medium_buffer[7 * 8 * 2 * 9];       // 21x24 pixels (1 pixel -> 3x3) -> 11 column, 10 row, 4 x_off, 0 y_off            
-static char char_large_buffer[7 * 8 * 2 * 16];       // 28x32 pixels (1 pixel -> 4x4) ->  8 column,  7 row, 8 x_off, 8 y_off
-static char char_extra_large_buffer[7 * 8 * 2 * 25]; // 35x40 pixels (1 pixel -> 5x5) ->  6 column,  6 row, 15 x_off, 0 y_off
-static char char_title_buffer[7 * 8 * 2 * 36];       // 42x48 pixels (1 pixel -> 6x6) ->  5 column,  5 row, 15 x_off, 0 y_off
+// Slots per size, the big sizes rarely have more than a few different characters on screen
+#define GLYPH_SLOTS_EXTRA_SMALL 16
+#define GLYPH_SLOTS_SMALL       8
+#define GLYPH_SLOTS_MEDIUM      4
+#define GLYPH_SLOTS_LARGE       3
+#define GLYPH_SLOTS_EXTRA_LARGE 2
+#define GLYPH_SLOTS_TITLE       2
+
+static uint8_t char_extra_small_buffer[GLYPH_SLOTS_EXTRA_SMALL][7 * 8 * 2];       // 7x8   pixels (1 pixel -> 1x1) -> 34 column, 30 row, 1 x_off, 0 y_off
+static uint8_t char_small_buffer[GLYPH_SLOTS_SMALL][7 * 8 * 2 * 4];               // 14x16 pixels (1 pixel -> 2x2) -> 17 column, 15 row, 1 x_off, 0 y_off
+static uint8_t char_medium_buffer[GLYPH_SLOTS_MEDIUM][7 * 8 * 2 * 9];             // 21x24 pixels (1 pixel -> 3x3) -> 11 column, 10 row, 4 x_off, 0 y_off
+static uint8_t char_large_buffer[GLYPH_SLOTS_LARGE][7 * 8 * 2 * 16];              // 28x32 pixels (1 pixel -> 4x4) ->  8 column,  7 row, 8 x_off, 8 y_off
+static uint8_t char_extra_large_buffer[GLYPH_SLOTS_EXTRA_LARGE][7 * 8 * 2 * 25];  // 35x40 pixels (1 pixel -> 5x5) ->  6 column,  6 row, 15 x_off, 0 y_off
+static uint8_t char_title_buffer[GLYPH_SLOTS_TITLE][7 * 8 * 2 * 36];              // 42x48 pixels (1 pixel -> 6x6) ->  5 column,  5 row, 15 x_off, 0 y_off
+
+static GLYPH_CACHE_ENTRY char_extra_small_cache[GLYPH_SLOTS_EXTRA_SMALL];
+static GLYPH_CACHE_ENTRY char_small_cache[GLYPH_SLOTS_SMALL];
+static GLYPH_CACHE_ENTRY char_medium_cache[GLYPH_SLOTS_MEDIUM];
+static GLYPH_CACHE_ENTRY char_large_cache[GLYPH_SLOTS_LARGE];
+static GLYPH_CACHE_ENTRY char_extra_large_cache[GLYPH_SLOTS_EXTRA_LARGE];
+static GLYPH_CACHE_ENTRY char_title_cache[GLYPH_SLOTS_TITLE];
+static uint32_t glyph_cache_clock = 0;
+
+// Everything drawn is streamed through two small line buffers, one is filled while the other is on the wire
+#define LINE_BUFFER_ROWS 8
+#define LINE_BUFFER_SIZE (SCREEN_WIDTH * 2 * LINE_BUFFER_ROWS)
+static uint8_t line_buffers[2][LINE_BUFFER_SIZE];
 
 static CHAR_INFO chars[6] = {
   {
-    .buffer     = char_extra_small_buffer,
+    .buffer     = char_extra_small_buffer[0],
+    .cache      = char_extra_small_cache,
+    .slots      = GLYPH_SLOTS_EXTRA_SMALL,
     .width      = 7,
     .height     = 8,
     .x_offset   = 1,
@@ -30,7 +65,9 @@ static CHAR_INFO chars[6] = {
     .max_row    = 30
   },
   {
-    .buffer     = char_small_buffer,
+    .buffer     = char_small_buffer[0],
+    .cache      = char_small_cache,
+    .slots      = GLYPH_SLOTS_SMALL,
     .width      = 14,
     .height     = 16,
     .x_offset   = 1,
@@ -39,7 +76,9 @@ static CHAR_INFO chars[6] = {
     .max_row    = 15
   },
   {
-    .buffer     = char_medium_buffer,
+    .buffer     = char_medium_buffer[0],
+    .cache      = char_medium_cache,
+    .slots      = GLYPH_SLOTS_MEDIUM,
     .width      = 21,
     .height     = 24,
     .x_offset   = 4,
@@ -48,7 +87,9 @@ static CHAR_INFO chars[6] = {
     .max_row    = 10
   },
   {
-    .buffer     = char_large_buffer,
+    .buffer     = char_large_buffer[0],
+    .cache      = char_large_cache,
+    .slots      = GLYPH_SLOTS_LARGE,
     .width      = 28,
     .height     = 32,
     .x_offset   = 8,
@@ -57,7 +98,9 @@ static CHAR_INFO chars[6] = {
     .max_row    = 7
   },
   {
-    .buffer     = char_extra_large_buffer,
+    .buffer     = char_extra_large_buffer[0],
+    .cache      = char_extra_large_cache,
+    .slots      = GLYPH_SLOTS_EXTRA_LARGE,
     .width      = 35,
     .height     = 40,
     .x_offset   = 15,
@@ -66,7 +109,9 @@ static CHAR_INFO chars[6] = {
     .max_row    = 6
   },
   {
-    .buffer     = char_title_buffer,
+    .buffer     = char_title_buffer[0],
+    .cache      = char_title_cache,
+    .slots      = GLYPH_SLOTS_TITLE,
     .width      = 42,
     .height     = 48,
     .x_offset   = 15,
@@ -177,78 +222,143 @@ const char font[96][7] = {
 	{0x00,0x00,0x00,0x00,0x00,0x00,0x00}
 };
 
-static uint8_t map(uint8_t x, uint8_t in_min, uint8_t in_max, uint8_t out_min, uint8_t out_max)
+// Scale rows first_row.. of a character into dest, every font pixel becomes a size x size block.
+//  Font row i is bit i of each column byte.
+static void lcd_scale_glyph(uint8_t* dest, uint16_t pitch, char character, LCD_CHAR_SIZE size, uint16_t color,
+                            uint16_t first_row, uint16_t rows, uint16_t columns)
 {
-  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+  for (uint16_t row = first_row; row < first_row + rows; row++)
+  {
+    uint8_t* pixel = dest;
+
+    for (uint16_t column = 0; column < columns; column++)
+    {
+      bool set = font[character - ' '][column / size] & (1 << (row / size));
+      *pixel++ = set ? color >> 8 : 0x00;
+      *pixel++ = set ? color : 0x00;
+    }
+    dest += pitch;
+  }
 }
 
-void lcd_write_char(char character, uint8_t x, uint8_t y, LCD_CHAR_SIZE size, uint8_t red, uint8_t green, uint8_t blue)
+// Scaled glyph for a character, straight from the cache or scaled into the least recently used slot.
+//  Slots used after pinned_after are left alone, NULL if that is all of them.
+static const uint8_t* lcd_glyph(char character, LCD_CHAR_SIZE size, uint16_t color, uint32_t pinned_after)
 {
-  CHAR_INFO tmp_char = chars[size - 1]; // Size is enumerated starting at 1
+  CHAR_INFO* info = &chars[size - 1]; // Size is enumerated starting at 1
+  uint16_t glyph_bytes = info->width * info->height * 2;
+  uint8_t slot = 0;
+  uint8_t* buffer;
 
-  uint16_t color = lcd_RGB(red, green, blue);
+  for (uint8_t i = 0; i < info->slots; i++)
+  {
+    if (info->cache[i].last_used && info->cache[i].character == character && info->cache[i].color == color)
+    {
+      info->cache[i].last_used = ++glyph_cache_clock;
+      return info->buffer + i * glyph_bytes;
+    }
+    if (info->cache[i].last_used < info->cache[slot].last_used) slot = i;
+  }
+  if (info->cache[slot].last_used > pinned_after) return NULL;
 
-  // First create the base image
-  uint16_t charArrayIndex = 0;
-  for (int i = 0; i < 8; i++){
-      for (int j = 0; j < 7; j++){
-          if (font[character - ' '][j] & (1<<i)) {
-              char_extra_small_buffer[charArrayIndex++] = color >> 8;
-              char_extra_small_buffer[charArrayIndex++] = color;
-          } else {
-              char_extra_small_buffer[charArrayIndex++] = 0x00;
-              char_extra_small_buffer[charArrayIndex++] = 0x00;
-          }
-      }
+  buffer = info->buffer + slot * glyph_bytes;
+  lcd_scale_glyph(buffer, info->width * 2, character, size, color, 0, info->height, info->width);
+
+  info->cache[slot].character = character;
+  info->cache[slot].color = color;
+  info->cache[slot].last_used = ++glyph_cache_clock;
+  return buffer;
+}
+
+// Draw characters side by side as one window. The run is composed a band of rows at a time so it
+//  goes out in a few transfers rather than a window and a transfer per character, each band is
+//  composed while the one before it is still being sent.
+static void lcd_draw_run(const char* string, uint16_t count, uint8_t x, uint8_t y, LCD_CHAR_SIZE size, uint16_t color)
+{
+  CHAR_INFO* info = &chars[size - 1]; // Size is enumerated starting at 1
+  uint16_t run_width = count * info->width;
+  uint16_t run_height = info->height;
+  uint16_t pitch, band_rows;
+  uint8_t band = 0;
+  const uint8_t* glyphs[SCREEN_WIDTH / 7 + 1]; // Narrowest size across the whole panel
+  char characters[SCREEN_WIDTH / 7 + 1];
+  uint32_t run_start = glyph_cache_clock;
+
+  if (count == 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+
+  // Clip to the panel, only characters that are at least partly on it are drawn
+  if (x + run_width > SCREEN_WIDTH) run_width = SCREEN_WIDTH - x;
+  if (y + run_height > SCREEN_HEIGHT) run_height = SCREEN_HEIGHT - y;
+  count = (run_width + info->width - 1) / info->width;
+  pitch = run_width * 2;
+
+  // Glyphs are looked up once for the whole run and their slots are kept until it is drawn. A run
+  //  can hold more different characters than there are slots, those are scaled into each band instead.
+  for (uint16_t i = 0; i < count; i++)
+  {
+    // Anything outside the font draws as a space
+    characters[i] = (string[i] < ' ' || string[i] > '~') ? ' ' : string[i];
+    glyphs[i] = lcd_glyph(characters[i], size, color, run_start);
   }
 
-  if (size > 1){
-    charArrayIndex = 0;
-    uint16_t bigCharArrayIndex = 0;
-    for (int i = 0; i < 8; i++){ // For every original row
-      for (int j = 0; j < size; j++){ // Repeat that row scale_factor number of times
-        charArrayIndex = i * 7 * 2; // Reset index to start of current row to print again
-        for (int k = 0; k < 7; k++){ // Print every pixel column
-            for (int l = 0; l < size; l++){ // Repeat same pixel scale_factor number of times
-                tmp_char.buffer[bigCharArrayIndex++] = char_extra_small_buffer[charArrayIndex++]; // Write first pixel and increment
-                tmp_char.buffer[bigCharArrayIndex++] = char_extra_small_buffer[charArrayIndex--]; // Write second pixel and decrement back to first pixel
-            }
-            charArrayIndex+=2; // Increment original pointer to the next pixel
-        }
+  GC9A01A_set_position(x, x + run_width - 1, y, y + run_height - 1);
+  GC9A01A_stream_begin();
+  for (uint16_t row = 0; row < run_height; row += band_rows, band ^= 1)
+  {
+    uint8_t* buffer = line_buffers[band];
+
+    band_rows = LINE_BUFFER_SIZE / pitch;
+    if (band_rows > run_height - row) band_rows = run_height - row;
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+      uint16_t left = i * info->width;
+      uint16_t columns = run_width - left < info->width ? run_width - left : info->width;
+
+      if (!glyphs[i])
+      {
+        lcd_scale_glyph(&buffer[left * 2], pitch, characters[i], size, color, row, band_rows, columns);
+        continue;
+      }
+      for (uint16_t r = 0; r < band_rows; r++)
+      {
+        memcpy(&buffer[r * pitch + left * 2], &glyphs[i][(row + r) * info->width * 2], columns * 2);
       }
     }
-  }  
 
-  // Set row and column for character
-  GC9A01A_set_position(x, x + tmp_char.width - 1, y, y + tmp_char.height - 1);
+    GC9A01A_stream(buffer, band_rows * pitch);
+  }
+  GC9A01A_stream_end();
+}
 
-  // Write character
-  GC9A01A_write(tmp_char.buffer, tmp_char.width * tmp_char.height * 2);
-    
+void lcd_write_char(char character, uint8_t x, uint8_t y, LCD_CHAR_SIZE size, uint8_t red, uint8_t green, uint8_t blue)
+{
+  lcd_draw_run(&character, 1, x, y, size, lcd_RGB(red, green, blue));
 }
 
 void lcd_write_str(char* string, uint8_t x, uint8_t y, LCD_CHAR_SIZE size, uint8_t red, uint8_t green, uint8_t blue)
 {
-  CHAR_INFO tmp_char = chars[size - 1]; // Size is enumerated starting at 1
-  int i = 0;
-  while (string[i] != '\0')
-  {
-    lcd_write_char(string[i], x + (i * tmp_char.width), y, size, red, green, blue);
-    i++;
-  }
+  lcd_draw_run(string, strlen(string), x, y, size, lcd_RGB(red, green, blue));
 }
 
 // Place a character at a specific location based on a row and column scheme dependent on the size of the character
 void lcd_write_char_grid(char character, uint8_t row, uint8_t column, LCD_CHAR_SIZE size, uint8_t red, uint8_t green, uint8_t blue)
 {
-  CHAR_INFO tmp_char = chars[size - 1]; // Size is enumerated starting at 1 
+  CHAR_INFO tmp_char = chars[size - 1]; // Size is enumerated starting at 1
   lcd_write_char(character, tmp_char.x_offset + (column * tmp_char.width), tmp_char.y_offset + (row * tmp_char.height), size, red, green, blue);
 }
 
 // Print a string to the LCD starting at the specified row and column. This function will wrap the text if the end of the row is reached.
+// Each grid row of the string is drawn as one run
 void lcd_write_str_grid(char* string, uint8_t row, uint8_t column, LCD_CHAR_SIZE size, uint8_t red, uint8_t green, uint8_t blue)
 {
-  CHAR_INFO tmp_char = chars[size - 1]; // Size is enumerated starting at 1 
+  CHAR_INFO tmp_char = chars[size - 1]; // Size is enumerated starting at 1
+  uint16_t color = lcd_RGB(red, green, blue);
+  int run_start = 0;
+  uint16_t run_length = 0;
+  uint8_t run_row = row;
+  uint8_t run_column = column;
+
   if (row > tmp_char.max_row || column > tmp_char.max_column)
   {
     return;
@@ -281,18 +391,31 @@ void lcd_write_str_grid(char* string, uint8_t row, uint8_t column, LCD_CHAR_SIZE
       row++;
     }
 
+    // Moved on to the next row, draw the one that is done
+    if (row != run_row)
+    {
+      lcd_draw_run(&string[run_start], run_length, tmp_char.x_offset + (run_column * tmp_char.width), tmp_char.y_offset + (run_row * tmp_char.height), size, color);
+      run_length = 0;
+      run_row = row;
+    }
+
     if (row >= tmp_char.max_row) // >= because it is zero indexed
     {
       // There is no more space to write to on the screen
       return;
     }
 
-    lcd_write_char_grid(string[i], row, column, size, red, green, blue);
+    if (run_length == 0)
+    {
+      run_start = i;
+      run_column = column;
+    }
+    run_length++;
     column++;
     i++;
   }
 
-  return;
+  lcd_draw_run(&string[run_start], run_length, tmp_char.x_offset + (run_column * tmp_char.width), tmp_char.y_offset + (run_row * tmp_char.height), size, color);
 }
 
 void lcd_draw_bitmap(uint8_t* bitmap, uint8_t width, uint8_t height, uint8_t x, uint8_t y)
@@ -300,22 +423,37 @@ void lcd_draw_bitmap(uint8_t* bitmap, uint8_t width, uint8_t height, uint8_t x,
   if (width > 240 || height > 240 || x > 240 || x > 240 || bitmap == NULL) return;
   // It will be assumed that the bitmap memory is already in 5-6-5 RGB format
   // It will also be assumed that the buffer provided is of the proper size
-  
-  // Position screen cursor to the provided x and y
-  GC9A01A_set_position(x, x + width - 1, y, y + height - 1);
 
-  // Write the provided bitmap data
-  GC9A01A_write(bitmap, width * height * 2);
+  // Sent straight from where it is stored, no copy into RAM first
+  GC9A01A_set_position(x, x + width - 1, y, y + height - 1);
+  GC9A01A_stream_begin();
+  GC9A01A_stream(bitmap, width * height * 2);
+  GC9A01A_stream_end();
 }
 
 void lcd_fill(uint8_t red, uint8_t green, uint8_t blue)
 {
-  GC9A01A_fill_screen(lcd_RGB(red, green, blue));
+  // Every row is the same, so one line buffer of the color is sent over and over
+  uint16_t color = lcd_RGB(red, green, blue);
+  uint8_t* buffer = line_buffers[0];
+
+  for (int i = 0; i < LINE_BUFFER_SIZE; i += 2)
+  {
+    buffer[i] = color >> 8;
+    buffer[i + 1] = color & 0xFF;
+  }
+
+  GC9A01A_set_position(0, SCREEN_WIDTH - 1, 0, SCREEN_HEIGHT - 1);
+  GC9A01A_stream_begin();
+  for (int row = 0; row < SCREEN_HEIGHT; row += LINE_BUFFER_ROWS)
+  {
+    GC9A01A_stream(buffer, LINE_BUFFER_SIZE);
+  }
+  GC9A01A_stream_end();
 }
 
 void lcd_clear(void)
 {
-  // As there is no clear screen command this is the best we can do, avoid using
   lcd_fill(0, 0, 0);
 }
 
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 
 #include "GC9A01A.h"
+#include "GC9A01A_emu.h"
 #include "LCD.h"
 #include "assets.h"
 
@@ -15,7 +16,6 @@ typedef struct Notification {
     time_t timestamp;
 } Notification;
 uint8_t notificationCount = 0;
-static char stringBuffer[512]; // To hold notification transfer
 
 Notification activeNotifications[5] = 
 {
@@ -53,50 +53,39 @@ Notification activeNotifications[5] =
 
 uint8_t notificationIndex = 0;
 
+// The old text dump for GeckoImage.py, 2 bytes per pixel in 5-6-5
 void writeScreenBufferToFile(void)
 {
     FILE* file = fopen("./image.txt", "w");
-    for (int i = 0; i < SCREEN_BUFFER_LENGTH - 1; i++)
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++)
     {
-        fprintf(file, "%x,", screenBuffer[i]);
+        uint16_t pixel = GC9A01A_emu_pixel(i % SCREEN_WIDTH, i / SCREEN_WIDTH);
+        fprintf(file, (i < SCREEN_WIDTH * SCREEN_HEIGHT - 1) ? "%x,%x," : "%x,%x", pixel >> 8, pixel & 0xFF);
     }
-    fprintf(file, "%x", screenBuffer[SCREEN_BUFFER_LENGTH - 1]);
     fclose(file);
 }
 
-static void app_notification_cb(char* notification, int len) {
-    char* splitIndex;
+// Usage: main [frame.png] [--txt] [--trace trace.gtrc]
+int main(int argc, char** argv)
+{
+    const char* framePath = "./image.png";
+    const char* tracePath = NULL;
+    int writeText = 0;
+    int err;
 
-    // There is no null terminator but need it to parse so copy string into buffer and add it
-    for (int i = 0; i < len; i++){
-        stringBuffer[i] = notification[i];
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--txt") == 0) writeText = 1;
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) tracePath = argv[++i];
+        else framePath = argv[i];
     }
-    stringBuffer[len] = '\0';
-
-    // Read in app name
-    splitIndex = strtok(stringBuffer, "::");
-    strncpy(activeNotifications[notificationCount].appName, splitIndex, 64);
-
-    // Read in title
-    splitIndex = strtok(NULL, "::");
-    strncpy(activeNotifications[notificationCount].title, splitIndex, 64);
 
-    // Read in text
-    splitIndex = strtok(NULL, "::");
-    strncpy(activeNotifications[notificationCount].text, splitIndex, 256);
+    // Bring the panel up with the firmware's init sequence, only the drawing below is counted
+    GC9A01A_emu_reset();
+    GC9A01A_init();
+    GC9A01A_emu_reset_stats();
+    if (tracePath) GC9A01A_emu_trace_start();
 
-    // Read in timestamp
-    splitIndex = strtok(NULL, ":");
-    activeNotifications[notificationCount].timestamp = (time_t) atoi(splitIndex);
-
-    printf("Received and read in notification: %s, %s, %s, %lld\r\n", activeNotifications[notificationCount].appName,
-                                                                    activeNotifications[notificationCount].title,
-                                                                    activeNotifications[notificationCount].text,
-                                                                    activeNotifications[notificationCount].timestamp);
-}
-
-int main()
-{
     // lcd_write_str(activeNotifications[0].appName, 50, 50, LCD_CHAR_MEDIUM, 0xFF, 0x00, 0x00);
     // for (int i = 0; i < 15; i++) lcd_write_str_grid(activeNotifications[0].appName, i, 2, LCD_CHAR_SMALL, 0xFF, 0xFF, 0xFF);
 
@@ -120,30 +109,8 @@ int main()
     // lcd_write_str(timeBuffer, 72, 110, LCD_CHAR_SMALL, 0xFF, 0xFF, 0xFF);
     // printf("%s\n", timeBuffer);
 
-
-    // printf("Yo\n");
-    // char testString[] = "Textra::Beans::On Toast::1234";
-    
-    // app_notification_cb(testString, 30);
-
-
-    // char* location = strtok(testString, "::");
-    // printf("%s\n", location);
-
-    // location = strtok(NULL, "::");
-    // printf("%s\n", location);
-
-    // location = strtok(NULL, "::");
-    // printf("%s\n", location);
-
-    // location = strtok(NULL, "::");
-    // printf("%s\n", location);
-
-    // location = strtok(NULL, ":");
-    // printf("%s\n", location);    
-
-    // printf("What?\n");
-    
-    writeScreenBufferToFile();
-    return 0;
+    if (writeText) writeScreenBufferToFile();
+    err = GC9A01A_emu_frame(framePath);
+    if (tracePath) err |= GC9A01A_emu_trace_save(tracePath);
+    return err ? 1 : 0;
 }
\ No newline at end of file
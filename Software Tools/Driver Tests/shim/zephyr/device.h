@@ -0,0 +1,34 @@
+#ifndef __DRIVER_TESTS_DEVICE_H__
+#define __DRIVER_TESTS_DEVICE_H__
+
+#include <zephyr/kernel.h>
+
+struct device {
+    const char *name;
+    const void *config;
+    const void *api;
+    void *data;
+};
+
+bool device_is_ready(const struct device *dev);
+
+// The one devicetree node the tests have, a 240x240 panel without te-gpios
+#define DT_DRV_INST(inst)               0
+#define DT_NODELABEL(label)             0
+#define DT_INST_PROP(inst, prop)        FAKE_DT_##prop
+#define DT_INST_NODE_HAS_PROP(inst, prop) 0
+#define FAKE_DT_width                   240
+#define FAKE_DT_height                  240
+
+// The driver under test, its init function is left for the test to call
+extern const struct device fake_display;
+extern int (*const fake_display_init)(const struct device *dev);
+
+#define DEVICE_DT_GET(node)             (&fake_display)
+#define DEVICE_DT_INST_DEFINE(inst, init_fn, pm, data_ptr, config_ptr, level, prio, api_ptr) \
+    const struct device fake_display = { \
+        .name = "gc9a01", .config = (config_ptr), .api = (api_ptr), .data = (data_ptr) \
+    }; \
+    int (*const fake_display_init)(const struct device *dev) = init_fn
+
+#endif // __DRIVER_TESTS_DEVICE_H__
@@ -0,0 +1,52 @@
+#ifndef __DRIVER_TESTS_DISPLAY_H__
+#define __DRIVER_TESTS_DISPLAY_H__
+
+#include <zephyr/device.h>
+
+enum display_pixel_format {
+    PIXEL_FORMAT_RGB_888 = BIT(0),
+    PIXEL_FORMAT_RGB_565 = BIT(4),
+    PIXEL_FORMAT_BGR_565 = BIT(5),
+};
+
+enum display_screen_info {
+    SCREEN_INFO_MONO_VTILED = BIT(0),
+    SCREEN_INFO_MONO_MSB_FIRST = BIT(1),
+};
+
+enum display_orientation {
+    DISPLAY_ORIENTATION_NORMAL,
+};
+
+struct display_capabilities {
+    uint16_t x_resolution;
+    uint16_t y_resolution;
+    uint32_t supported_pixel_formats;
+    uint32_t screen_info;
+    enum display_pixel_format current_pixel_format;
+    enum display_orientation current_orientation;
+};
+
+struct display_buffer_descriptor {
+    uint32_t buf_size;
+    uint16_t width;
+    uint16_t height;
+    uint16_t pitch;
+};
+
+struct display_driver_api {
+    int (*blanking_on)(const struct device *dev);
+    int (*blanking_off)(const struct device *dev);
+    int (*write)(const struct device *dev, const uint16_t x, const uint16_t y,
+                 const struct display_buffer_descriptor *desc, const void *buf);
+    int (*read)(const struct device *dev, const uint16_t x, const uint16_t y,
+                const struct display_buffer_descriptor *desc, void *buf);
+    void *(*get_framebuffer)(const struct device *dev);
+    int (*set_brightness)(const struct device *dev, const uint8_t brightness);
+    int (*set_contrast)(const struct device *dev, const uint8_t contrast);
+    void (*get_capabilities)(const struct device *dev, struct display_capabilities *caps);
+    int (*set_pixel_format)(const struct device *dev, const enum display_pixel_format pf);
+    int (*set_orientation)(const struct device *dev, const enum display_orientation orientation);
+};
+
+#endif // __DRIVER_TESTS_DISPLAY_H__
@@ -0,0 +1,42 @@
+#ifndef __DRIVER_TESTS_GPIO_H__
+#define __DRIVER_TESTS_GPIO_H__
+
+#include <zephyr/device.h>
+
+typedef uint32_t gpio_pin_t;
+typedef uint32_t gpio_flags_t;
+typedef uint32_t gpio_port_pins_t;
+
+// Pins are told apart by the devicetree property they came from
+enum fake_gpio_pin {
+    FAKE_PIN_reset_gpios,
+    FAKE_PIN_dc_gpios,
+    FAKE_PIN_te_gpios,
+};
+
+struct gpio_dt_spec {
+    const struct device *port;
+    gpio_pin_t pin;
+    gpio_flags_t dt_flags;
+};
+
+extern const struct device fake_gpio;
+#define GPIO_DT_SPEC_INST_GET(inst, prop)   { .port = &fake_gpio, .pin = FAKE_PIN_##prop }
+
+#define GPIO_INPUT              BIT(16)
+#define GPIO_OUTPUT_ACTIVE      BIT(17)
+#define GPIO_OUTPUT_INACTIVE    BIT(18)
+#define GPIO_INT_EDGE_TO_ACTIVE BIT(19)
+
+struct gpio_callback;
+typedef void (*gpio_callback_handler_t)(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins);
+
+struct gpio_callback {
+    gpio_callback_handler_t handler;
+    gpio_port_pins_t pin_mask;
+};
+
+int gpio_pin_set_dt(const struct gpio_dt_spec *spec, int value);
+int gpio_pin_configure_dt(const struct gpio_dt_spec *spec, gpio_flags_t flags);
+
+#endif // __DRIVER_TESTS_GPIO_H__
@@ -0,0 +1,18 @@
+#ifndef __DRIVER_TESTS_PWM_H__
+#define __DRIVER_TESTS_PWM_H__
+
+#include <zephyr/device.h>
+
+struct pwm_dt_spec {
+    const struct device *dev;
+    uint32_t channel;
+    uint32_t period;
+    uint32_t flags;
+};
+
+extern const struct device fake_pwm;
+#define PWM_DT_SPEC_GET(node)   { .dev = &fake_pwm, .period = 1000000 }
+
+int pwm_set_dt(const struct pwm_dt_spec *spec, uint32_t period, uint32_t pulse);
+
+#endif // __DRIVER_TESTS_PWM_H__
@@ -0,0 +1,54 @@
+#ifndef __DRIVER_TESTS_SPI_H__
+#define __DRIVER_TESTS_SPI_H__
+
+#include <zephyr/drivers/gpio.h>
+
+#define SPI_OP_MODE_MASTER  0
+#define SPI_WORD_SET(bits)  ((bits) << 5)
+#define SPI_HOLD_ON_CS      BIT(12)
+#define SPI_LOCK_ON         BIT(13)
+
+struct spi_config {
+    uint32_t frequency;
+    uint16_t operation;
+    uint16_t slave;
+};
+
+struct spi_dt_spec {
+    const struct device *bus;
+    struct spi_config config;
+};
+
+struct spi_buf {
+    void *buf;
+    size_t len;
+};
+
+struct spi_buf_set {
+    const struct spi_buf *buffers;
+    size_t count;
+};
+
+typedef void (*spi_callback_t)(const struct device *dev, int result, void *data);
+
+extern const struct device fake_spi;
+#define SPI_DT_SPEC_INST_GET(inst, op, delay) \
+    { .bus = &fake_spi, .config = { .frequency = 32000000, .operation = (op) } }
+
+int spi_write(const struct device *dev, const struct spi_config *config, const struct spi_buf_set *tx_bufs);
+int spi_transceive_cb(const struct device *dev, const struct spi_config *config,
+                      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
+                      spi_callback_t callback, void *userdata);
+int spi_release(const struct device *dev, const struct spi_config *config);
+
+static inline int spi_write_dt(const struct spi_dt_spec *spec, const struct spi_buf_set *tx_bufs)
+{
+    return spi_write(spec->bus, &spec->config, tx_bufs);
+}
+
+static inline bool spi_is_ready_dt(const struct spi_dt_spec *spec)
+{
+    return device_is_ready(spec->bus);
+}
+
+#endif // __DRIVER_TESTS_SPI_H__
@@ -0,0 +1,6 @@
+#ifndef __DRIVER_TESTS_INIT_H__
+#define __DRIVER_TESTS_INIT_H__
+
+#include <zephyr/device.h>
+
+#endif // __DRIVER_TESTS_INIT_H__
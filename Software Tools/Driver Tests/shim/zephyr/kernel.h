@@ -0,0 +1,104 @@
+#ifndef __DRIVER_TESTS_KERNEL_H__
+#define __DRIVER_TESTS_KERNEL_H__
+
+// Just enough of zephyr's kernel API for the display driver to build and run on a PC. Nothing runs
+//  in the background, see fake.h for how work items and DMA completions get their turn.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+
+#define ARRAY_SIZE(array)   (sizeof(array) / sizeof((array)[0]))
+#define MIN(a, b)           (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)           (((a) > (b)) ? (a) : (b))
+#define BIT(n)              (1UL << (n))
+#define CONTAINER_OF(ptr, type, field) ((type *)(((char *)(ptr)) - offsetof(type, field)))
+#define __ASSERT(test, ...) assert(test)
+
+// Same trick zephyr uses, true only for a config defined to 1
+#define _XXXX1 _YYYY,
+#define IS_ENABLED(config_macro)        _IS_ENABLED1(config_macro)
+#define _IS_ENABLED1(config_macro)      _IS_ENABLED2(_XXXX##config_macro)
+#define _IS_ENABLED2(one_or_two_args)   _IS_ENABLED3(one_or_two_args 1, 0)
+#define _IS_ENABLED3(ignore_this, val, ...) val
+
+typedef struct {
+    int64_t ms;
+} k_timeout_t;
+
+#define K_FOREVER   ((k_timeout_t){-1})
+#define K_NO_WAIT   ((k_timeout_t){0})
+#define K_MSEC(ms)  ((k_timeout_t){(ms)})
+
+struct k_sem {
+    unsigned int count;
+    unsigned int limit;
+};
+
+int k_sem_init(struct k_sem *sem, unsigned int initial_count, unsigned int limit);
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout);
+void k_sem_give(struct k_sem *sem);
+void k_sem_reset(struct k_sem *sem);
+unsigned int k_sem_count_get(struct k_sem *sem);
+
+struct k_mutex {
+    int lock_count;
+};
+
+int k_mutex_init(struct k_mutex *mutex);
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
+int k_mutex_unlock(struct k_mutex *mutex);
+
+struct k_spinlock {
+    int locked;
+};
+
+typedef int k_spinlock_key_t;
+
+k_spinlock_key_t k_spin_lock(struct k_spinlock *lock);
+void k_spin_unlock(struct k_spinlock *lock, k_spinlock_key_t key);
+
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+
+struct k_work {
+    k_work_handler_t handler;
+};
+
+struct k_work_delayable {
+    struct k_work work;
+    int64_t due_ms;
+    bool pending;
+};
+
+struct k_work_q {
+    int unused;
+};
+
+#define K_THREAD_STACK_DEFINE(sym, size)    char sym[size]
+#define K_THREAD_STACK_SIZEOF(sym)          sizeof(sym)
+
+void k_work_queue_start(struct k_work_q *queue, void *stack, size_t stack_size, int prio, const void *cfg);
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork, k_timeout_t delay);
+int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork, k_timeout_t delay);
+
+static inline struct k_work_delayable *k_work_delayable_from_work(struct k_work *work)
+{
+    return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+// Time only moves when the driver sleeps or a test advances it, one cycle is a microsecond
+int64_t k_uptime_get(void);
+uint32_t k_cycle_get_32(void);
+int32_t k_msleep(int32_t ms);
+void k_busy_wait(uint32_t us);
+
+static inline uint64_t k_cyc_to_us_floor64(uint64_t cycles) { return cycles; }
+static inline uint32_t k_cyc_to_us_floor32(uint32_t cycles) { return cycles; }
+
+#endif // __DRIVER_TESTS_KERNEL_H__
@@ -0,0 +1,37 @@
+#ifndef __DRIVER_TESTS_BYTEORDER_H__
+#define __DRIVER_TESTS_BYTEORDER_H__
+
+#include <stdint.h>
+
+static inline void sys_put_be16(uint16_t val, uint8_t dst[2])
+{
+    dst[0] = val >> 8;
+    dst[1] = val;
+}
+
+static inline void sys_put_be24(uint32_t val, uint8_t dst[3])
+{
+    dst[0] = val >> 16;
+    dst[1] = val >> 8;
+    dst[2] = val;
+}
+
+static inline uint16_t sys_get_be16(const uint8_t src[2])
+{
+    return ((uint16_t)src[0] << 8) | src[1];
+}
+
+static inline uint32_t sys_get_be32(const uint8_t src[4])
+{
+    return ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+}
+
+static inline void sys_put_le32(uint32_t val, uint8_t dst[4])
+{
+    dst[0] = val;
+    dst[1] = val >> 8;
+    dst[2] = val >> 16;
+    dst[3] = val >> 24;
+}
+
+#endif // __DRIVER_TESTS_BYTEORDER_H__
@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/pwm.h>
+#include "fake.h"
+
+#define CMD_MEM_WR          0x2C
+#define CMD_MEM_WR_CONT     0x3C
+#define MAX_WORK_ITEMS      8
+
+const struct device fake_gpio = { .name = "gpio" };
+const struct device fake_spi = { .name = "spi" };
+const struct device fake_pwm = { .name = "pwm" };
+
+fake_bus_stats_t fake_bus;
+uint8_t fake_pixels[FAKE_PIXELS_MAX];
+size_t fake_pixel_len;
+
+static uint64_t now_us;
+static int dc_level;
+static int last_cmd = -1;
+
+// The transfer on the wire, the buffer set belongs to the driver and is read when it finishes
+static struct {
+    bool busy;
+    int dc_level;
+    const struct spi_buf_set *tx_bufs;
+    spi_callback_t callback;
+    void *userdata;
+} dma;
+
+static struct k_work_delayable *work_items[MAX_WORK_ITEMS];
+static int work_item_count;
+
+void fake_bus_clear(void)
+{
+    memset(&fake_bus, 0, sizeof(fake_bus));
+    fake_pixel_len = 0;
+}
+
+void fake_reset(void)
+{
+    fake_bus_clear();
+    memset(&dma, 0, sizeof(dma));
+    now_us = 0;
+    dc_level = 0;
+    last_cmd = -1;
+    work_item_count = 0;
+}
+
+// One byte onto the panel's side of the bus
+static void bus_byte(int dc, uint8_t byte)
+{
+    if (dc == 0) {
+        fake_bus.commands++;
+        last_cmd = byte;
+        if (byte == CMD_MEM_WR) fake_bus.ram_writes++;
+        if (byte == CMD_MEM_WR_CONT) fake_bus.ram_write_continues++;
+        return;
+    }
+
+    if (last_cmd == CMD_MEM_WR || last_cmd == CMD_MEM_WR_CONT) {
+        if (fake_pixel_len == FAKE_PIXELS_MAX) {
+            fprintf(stderr, "fake: pixel record full\n");
+            abort();
+        }
+        fake_pixels[fake_pixel_len++] = byte;
+    }
+}
+
+static void bus_bufs(int dc, const struct spi_buf_set *bufs)
+{
+    for (size_t i = 0; i < bufs->count; i++) {
+        const uint8_t *data = bufs->buffers[i].buf;
+
+        for (size_t j = 0; j < bufs->buffers[i].len; j++) {
+            bus_byte(dc, data[j]);
+        }
+    }
+}
+
+bool fake_spi_busy(void)
+{
+    return dma.busy;
+}
+
+void fake_spi_complete(void)
+{
+    if (!dma.busy) return;
+
+    bus_bufs(dma.dc_level, dma.tx_bufs);
+    dma.busy = false;
+    fake_bus.async_completed++;
+    dma.callback(&fake_spi, 0, dma.userdata);
+}
+
+int spi_write(const struct device *dev, const struct spi_config *config, const struct spi_buf_set *tx_bufs)
+{
+    if (dma.busy) fake_bus.overlaps++;
+    fake_bus.transfers++;
+    bus_bufs(dc_level, tx_bufs);
+
+    return 0;
+}
+
+int spi_transceive_cb(const struct device *dev, const struct spi_config *config,
+                      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
+                      spi_callback_t callback, void *userdata)
+{
+    if (dma.busy) fake_bus.overlaps++;
+    fake_bus.transfers++;
+    fake_bus.async_started++;
+
+    dma.busy = true;
+    dma.dc_level = dc_level;
+    dma.tx_bufs = tx_bufs;
+    dma.callback = callback;
+    dma.userdata = userdata;
+
+    return 0;
+}
+
+int spi_release(const struct device *dev, const struct spi_config *config)
+{
+    return 0;
+}
+
+bool device_is_ready(const struct device *dev)
+{
+    return true;
+}
+
+int gpio_pin_set_dt(const struct gpio_dt_spec *spec, int value)
+{
+    if (spec->pin == FAKE_PIN_dc_gpios) {
+        // The DC line is sampled with every byte, flipping it under a running transfer corrupts it
+        if (dma.busy && value != dc_level) fake_bus.overlaps++;
+        dc_level = value;
+    }
+
+    return 0;
+}
+
+int gpio_pin_configure_dt(const struct gpio_dt_spec *spec, gpio_flags_t flags)
+{
+    return 0;
+}
+
+int pwm_set_dt(const struct pwm_dt_spec *spec, uint32_t period, uint32_t pulse)
+{
+    return 0;
+}
+
+int k_sem_init(struct k_sem *sem, unsigned int initial_count, unsigned int limit)
+{
+    sem->count = initial_count;
+    sem->limit = limit;
+
+    return 0;
+}
+
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout)
+{
+    // Blocking is when the DMA interrupt would get its turn
+    if (sem->count == 0 && timeout.ms != 0 && dma.busy) {
+        fake_bus.waits++;
+        fake_spi_complete();
+    }
+
+    if (sem->count == 0) {
+        if (timeout.ms == 0) return -EBUSY;
+        fprintf(stderr, "fake: k_sem_take() would block forever\n");
+        abort();
+    }
+
+    sem->count--;
+    return 0;
+}
+
+void k_sem_give(struct k_sem *sem)
+{
+    if (sem->count < sem->limit) sem->count++;
+}
+
+void k_sem_reset(struct k_sem *sem)
+{
+    sem->count = 0;
+}
+
+unsigned int k_sem_count_get(struct k_sem *sem)
+{
+    return sem->count;
+}
+
+int k_mutex_init(struct k_mutex *mutex)
+{
+    mutex->lock_count = 0;
+
+    return 0;
+}
+
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+    mutex->lock_count++;
+
+    return 0;
+}
+
+int k_mutex_unlock(struct k_mutex *mutex)
+{
+    if (mutex->lock_count == 0) {
+        fprintf(stderr, "fake: mutex unlocked more often than locked\n");
+        abort();
+    }
+    mutex->lock_count--;
+
+    return 0;
+}
+
+k_spinlock_key_t k_spin_lock(struct k_spinlock *lock)
+{
+    lock->locked++;
+
+    return 0;
+}
+
+void k_spin_unlock(struct k_spinlock *lock, k_spinlock_key_t key)
+{
+    lock->locked--;
+}
+
+void k_work_queue_start(struct k_work_q *queue, void *stack, size_t stack_size, int prio, const void *cfg)
+{
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler)
+{
+    memset(dwork, 0, sizeof(*dwork));
+    dwork->work.handler = handler;
+
+    for (int i = 0; i < work_item_count; i++) {
+        if (work_items[i] == dwork) return;
+    }
+    if (work_item_count == MAX_WORK_ITEMS) {
+        fprintf(stderr, "fake: too many work items\n");
+        abort();
+    }
+    work_items[work_item_count++] = dwork;
+}
+
+int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork, k_timeout_t delay)
+{
+    if (dwork->pending) return 0;
+
+    return k_work_reschedule_for_queue(queue, dwork, delay);
+}
+
+int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork, k_timeout_t delay)
+{
+    dwork->pending = true;
+    dwork->due_ms = k_uptime_get() + delay.ms;
+
+    return 1;
+}
+
+void fake_run_work(void)
+{
+    for (;;) {
+        struct k_work_delayable *next = NULL;
+
+        for (int i = 0; i < work_item_count; i++) {
+            if (work_items[i]->pending && (next == NULL || work_items[i]->due_ms < next->due_ms)) {
+                next = work_items[i];
+            }
+        }
+        if (next == NULL) return;
+
+        if (next->due_ms > k_uptime_get()) now_us = next->due_ms * 1000;
+        next->pending = false;
+        next->work.handler(&next->work);
+    }
+}
+
+void fake_display_start(void)
+{
+    fake_reset();
+    if (fake_display_init(&fake_display) != 0) {
+        fprintf(stderr, "fake: display init failed\n");
+        abort();
+    }
+    fake_run_work();
+    fake_bus_clear();
+}
+
+int64_t k_uptime_get(void)
+{
+    return now_us / 1000;
+}
+
+uint32_t k_cycle_get_32(void)
+{
+    return (uint32_t)now_us;
+}
+
+int32_t k_msleep(int32_t ms)
+{
+    now_us += (uint64_t)ms * 1000;
+
+    return 0;
+}
+
+void k_busy_wait(uint32_t us)
+{
+    now_us += us;
+}
@@ -0,0 +1,48 @@
+#ifndef __FAKE_H__
+#define __FAKE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+    The world around the driver: a fake kernel and a fake SPI bus with one DMA channel.
+    Nothing happens behind the driver's back. A transfer started with spi_transceive_cb() stays on
+    the wire until the test calls fake_spi_complete(), or until the driver blocks on a semaphore,
+    which is the only way it could get to run on the watch. Like the real DMA, the bytes are read
+    out of the caller's buffer when the transfer finishes, not when it starts.
+*/
+
+typedef struct {
+    uint32_t transfers;         // spi_write() and spi_transceive_cb() calls
+    uint32_t async_started;
+    uint32_t async_completed;
+    uint32_t waits;             // The driver blocked until the transfer on the wire was done
+    uint32_t overlaps;          // Bus or DC line touched while a transfer was still on the wire
+    uint32_t commands;
+    uint32_t ram_writes;        // RAMWR
+    uint32_t ram_write_continues; // MEM_WR_CONT
+} fake_bus_stats_t;
+
+extern fake_bus_stats_t fake_bus;
+
+// Everything sent after a RAMWR or MEM_WR_CONT, in the order it went out
+extern uint8_t fake_pixels[];
+extern size_t fake_pixel_len;
+#define FAKE_PIXELS_MAX     (240 * 240 * 2)
+
+// Clear the bus record, the clock and any pending work
+void fake_reset(void);
+void fake_bus_clear(void);
+
+// Finish the DMA transfer on the wire, if there is one, and run the driver's completion callback
+void fake_spi_complete(void);
+bool fake_spi_busy(void);
+
+// Run delayable work items as they come due, moving the clock along, until none are left
+void fake_run_work(void);
+
+// Bring the driver up the way the kernel would: device init and then the work it queued
+void fake_display_start(void);
+
+#endif // __FAKE_H__
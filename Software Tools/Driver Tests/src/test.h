@@ -0,0 +1,23 @@
+#ifndef __TEST_H__
+#define __TEST_H__
+
+#include <stdio.h>
+
+// Bare bones checks, a failed one is reported and the test carries on
+
+static int test_failures;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define RUN_TEST(test) do { \
+        int failures_before = test_failures; \
+        test(); \
+        printf("%-48s %s\n", #test, test_failures == failures_before ? "ok" : "FAILED"); \
+    } while (0)
+
+#endif // __TEST_H__
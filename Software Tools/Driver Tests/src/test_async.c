@@ -0,0 +1,174 @@
+// CONFIG_GC9A01_FLUSH_ASYNC: display_write() hands the pixels to the DMA and returns, the next
+//  write or command waits for that transfer before it touches the bus
+
+#include "gc9a01.c"
+#include "fake.h"
+#include "test.h"
+
+#define STRIPE_ROWS     10
+#define STRIPE_BYTES    (DISPLAY_WIDTH * STRIPE_ROWS * 2)
+
+static const struct display_driver_api *api;
+static uint8_t draw_bufs[2][STRIPE_BYTES];
+
+// What a render into a buffer leaves behind, different for every stripe
+static void render(uint8_t *buf, size_t len, int stripe)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(i * 7 + stripe * 31);
+    }
+}
+
+static int write_stripe(int stripe, const uint8_t *buf)
+{
+    struct display_buffer_descriptor desc = {
+        .buf_size = STRIPE_BYTES, .width = DISPLAY_WIDTH, .height = STRIPE_ROWS, .pitch = DISPLAY_WIDTH,
+    };
+
+    return api->write(&fake_display, 0, stripe * STRIPE_ROWS, &desc, buf);
+}
+
+static void test_write_returns_before_transfer_done(void)
+{
+    fake_display_start();
+    render(draw_bufs[0], STRIPE_BYTES, 0);
+
+    CHECK(write_stripe(0, draw_bufs[0]) == 0);
+
+    // Back with the pixels still on the wire and the completion callback not run yet
+    CHECK(fake_spi_busy());
+    CHECK(fake_bus.async_started == 1);
+    CHECK(fake_bus.async_completed == 0);
+    CHECK(k_sem_count_get(&gc9a01_data.tx_idle) == 0);
+    CHECK(fake_pixel_len == 0);
+
+    fake_spi_complete();
+    CHECK(k_sem_count_get(&gc9a01_data.tx_idle) == 1);
+    CHECK(fake_pixel_len == STRIPE_BYTES);
+    CHECK(memcmp(fake_pixels, draw_bufs[0], STRIPE_BYTES) == 0);
+    CHECK(fake_bus.overlaps == 0);
+}
+
+static void test_next_write_waits_for_transfer(void)
+{
+    fake_display_start();
+    render(draw_bufs[0], STRIPE_BYTES, 0);
+    CHECK(write_stripe(0, draw_bufs[0]) == 0);
+
+    // The next stripe is drawn while the first is still going out
+    CHECK(fake_spi_busy());
+    render(draw_bufs[1], STRIPE_BYTES, 1);
+    CHECK(fake_bus.waits == 0);
+
+    CHECK(write_stripe(1, draw_bufs[1]) == 0);
+
+    // The second write blocked on the first transfer before touching the bus, then started its own
+    CHECK(fake_bus.waits == 1);
+    CHECK(fake_bus.async_completed == 1);
+    CHECK(fake_bus.overlaps == 0);
+    CHECK(fake_spi_busy());
+    CHECK(fake_pixel_len == STRIPE_BYTES);
+    CHECK(memcmp(fake_pixels, draw_bufs[0], STRIPE_BYTES) == 0);
+
+    fake_spi_complete();
+    CHECK(fake_pixel_len == 2 * STRIPE_BYTES);
+    CHECK(memcmp(&fake_pixels[STRIPE_BYTES], draw_bufs[1], STRIPE_BYTES) == 0);
+}
+
+static void test_command_waits_for_transfer(void)
+{
+    fake_display_start();
+    // Past the 120 ms after sleep out so sleep in goes out right away
+    k_msleep(GC9A01_SLEEP_TOGGLE_SETTLE_MS);
+
+    render(draw_bufs[0], STRIPE_BYTES, 0);
+    CHECK(write_stripe(0, draw_bufs[0]) == 0);
+    CHECK(fake_spi_busy());
+
+    CHECK(api->blanking_on(&fake_display) == 0);
+    CHECK(fake_bus.waits == 1);
+    CHECK(fake_bus.overlaps == 0);
+    CHECK(!fake_spi_busy());
+    CHECK(memcmp(fake_pixels, draw_bufs[0], STRIPE_BYTES) == 0);
+}
+
+// LVGL with two draw buffers: render into one while the other is sent, a whole screen of stripes
+static void test_double_buffered_frame(void)
+{
+    static uint8_t expected[FAKE_PIXELS_MAX];
+    int stripes = DISPLAY_HEIGHT / STRIPE_ROWS;
+    int rendered_during_transfer = 0;
+    struct gc9a01_stats stats;
+
+    fake_display_start();
+    gc9a01_stats_reset(&fake_display);
+
+    for (int stripe = 0; stripe < stripes; stripe++) {
+        uint8_t *buf = draw_bufs[stripe & 1];
+
+        if (fake_spi_busy()) rendered_during_transfer++;
+        render(buf, STRIPE_BYTES, stripe);
+        memcpy(&expected[stripe * STRIPE_BYTES], buf, STRIPE_BYTES);
+        CHECK(write_stripe(stripe, buf) == 0);
+    }
+    fake_spi_complete();
+
+    CHECK(rendered_during_transfer == stripes - 1);
+    CHECK(fake_bus.waits == (uint32_t)(stripes - 1));
+    CHECK(fake_bus.overlaps == 0);
+    CHECK(fake_bus.async_started == (uint32_t)stripes);
+    CHECK(fake_pixel_len == (size_t)stripes * STRIPE_BYTES);
+    CHECK(memcmp(fake_pixels, expected, fake_pixel_len) == 0);
+
+    // Stripes directly below each other carry on with MEM_WR_CONT
+    CHECK(fake_bus.ram_writes == 1);
+    CHECK(fake_bus.ram_write_continues == (uint32_t)(stripes - 1));
+
+    gc9a01_stats_get(&fake_display, &stats);
+    CHECK(stats.flushes == (uint32_t)stripes);
+    CHECK(stats.bytes == (uint64_t)stripes * STRIPE_BYTES);
+}
+
+// What the flush callback saw, it may take its own locks so it has to run with stats_lock dropped
+static int flush_begins;
+static int flush_ends;
+static int flush_calls_locked;
+
+static void flush_cb(const struct device *dev, enum gc9a01_flush_event event, void *user_data)
+{
+    if (gc9a01_data.stats_lock.locked) flush_calls_locked++;
+    if (event == GC9A01_FLUSH_BEGIN) flush_begins++;
+    else flush_ends++;
+}
+
+static void test_flush_callback_outside_stats_lock(void)
+{
+    fake_display_start();
+    flush_begins = flush_ends = flush_calls_locked = 0;
+    CHECK(gc9a01_flush_callback_set(&fake_display, flush_cb, NULL) == 0);
+
+    render(draw_bufs[0], STRIPE_BYTES, 0);
+    CHECK(write_stripe(0, draw_bufs[0]) == 0);
+    CHECK(flush_begins == 1);
+    CHECK(flush_ends == 0);
+
+    // The end comes from the completion callback, in the SPI interrupt on the watch
+    fake_spi_complete();
+    CHECK(flush_ends == 1);
+    CHECK(flush_calls_locked == 0);
+
+    gc9a01_flush_callback_set(&fake_display, NULL, NULL);
+}
+
+int main(void)
+{
+    api = fake_display.api;
+
+    RUN_TEST(test_write_returns_before_transfer_done);
+    RUN_TEST(test_next_write_waits_for_transfer);
+    RUN_TEST(test_command_waits_for_transfer);
+    RUN_TEST(test_double_buffered_frame);
+    RUN_TEST(test_flush_callback_outside_stats_lock);
+
+    return test_failures ? 1 : 0;
+}
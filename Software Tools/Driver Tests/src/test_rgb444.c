@@ -0,0 +1,175 @@
+// CONFIG_GC9A01_COLOR_12BIT: RGB565 from the caller goes out packed down to RGB444, checked
+//  against a straightforward one pixel at a time packer. Also times the packing kernel.
+
+#include <time.h>
+#include "gc9a01.c"
+#include "fake.h"
+#include "test.h"
+
+#define BENCH_FRAMES    200
+
+static const struct display_driver_api *api;
+static uint8_t pixels[FAKE_PIXELS_MAX];
+static uint8_t expected[FAKE_PIXELS_MAX];
+
+// Big endian RGB565 to the controller's 12-bit format, nibbles R G B per pixel back to back.
+//  An odd pixel count ends on half a byte, the low nibble is left 0.
+static size_t reference_pack(uint8_t *dst, const uint8_t *src, size_t count)
+{
+    size_t nibble = 0;
+
+    memset(dst, 0, (count * 3 + 1) / 2);
+    for (size_t i = 0; i < count; i++) {
+        uint16_t pixel = (src[2 * i] << 8) | src[2 * i + 1];
+        uint8_t channels[3] = { pixel >> 12, (pixel >> 7) & 0x0F, (pixel >> 1) & 0x0F };
+
+        for (int c = 0; c < 3; c++, nibble++) {
+            dst[nibble / 2] |= (nibble & 1) ? channels[c] : channels[c] << 4;
+        }
+    }
+
+    return (nibble + 1) / 2;
+}
+
+static void fill_pixels(size_t count, uint32_t seed)
+{
+    for (size_t i = 0; i < count * 2; i++) {
+        seed = seed * 1664525 + 1013904223;
+        pixels[i] = seed >> 24;
+    }
+}
+
+static void test_pack_kernel_every_value(void)
+{
+    uint8_t src[4], packed[3], reference[3];
+    int mismatches = 0;
+
+    // Every RGB565 value in both halves of the 32-bit load
+    for (uint32_t value = 0; value <= 0xFFFF; value++) {
+        uint16_t other = (uint16_t)(value * 40503u);
+
+        sys_put_be16(value, &src[0]);
+        sys_put_be16(other, &src[2]);
+        gc9a01_pack_rgb444(packed, src, 1);
+        reference_pack(reference, src, 2);
+        if (memcmp(packed, reference, 3) != 0) mismatches++;
+    }
+    CHECK(mismatches == 0);
+}
+
+static void write_area_and_compare(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    struct display_buffer_descriptor desc = {
+        .buf_size = width * height * 2, .width = width, .height = height, .pitch = width,
+    };
+    size_t count = (size_t)width * height;
+    size_t len;
+
+    fake_display_start();
+    fill_pixels(count, width * 1000 + height);
+    len = reference_pack(expected, pixels, count);
+
+    CHECK(api->write(&fake_display, x, y, &desc, pixels) == 0);
+    CHECK(fake_pixel_len == len);
+    CHECK(memcmp(fake_pixels, expected, len) == 0);
+    CHECK(fake_bus.ram_writes == 1);
+    // One command per staging chunk, the rest continue where the last left off
+    CHECK(fake_bus.ram_write_continues == (len - 1) / GC9A01_PACK_CHUNK);
+}
+
+static void test_write_even_pixel_counts(void)
+{
+    write_area_and_compare(0, 0, 2, 1);
+    write_area_and_compare(10, 20, 8, 3);
+    write_area_and_compare(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+}
+
+static void test_write_odd_pixel_counts(void)
+{
+    // Trailing half pixel: 1 and 3 pixels end on a nibble
+    write_area_and_compare(0, 0, 1, 1);
+    write_area_and_compare(100, 100, 3, 1);
+    write_area_and_compare(5, 5, 7, 3);
+    write_area_and_compare(1, 0, 239, 7);
+    write_area_and_compare(0, 0, 17, 91);
+}
+
+// Several buffers, each an odd number of pixels, so the leftover pixel is carried from one to the
+//  next, across staging chunk boundaries too
+static void test_carry_between_buffers(void)
+{
+    static const size_t counts[] = { 7, 5, 1, 3, 1023, 1, 2047, 2, 9 };
+    struct spi_buf bufs[ARRAY_SIZE(counts)];
+    size_t total = 0;
+    size_t len;
+
+    fake_display_start();
+    for (size_t i = 0; i < ARRAY_SIZE(counts); i++) {
+        total += counts[i];
+    }
+    fill_pixels(total, 77);
+    len = reference_pack(expected, pixels, total);
+
+    total = 0;
+    for (size_t i = 0; i < ARRAY_SIZE(counts); i++) {
+        bufs[i].buf = &pixels[total * 2];
+        bufs[i].len = counts[i] * 2;
+        total += counts[i];
+    }
+
+    CHECK(gc9a01_write_pixels(&fake_display, MEM_WR, bufs, ARRAY_SIZE(bufs)) == 0);
+    CHECK(fake_pixel_len == len);
+    CHECK(memcmp(fake_pixels, expected, len) == 0);
+}
+
+static double elapsed_ns(const struct timespec *start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) * 1e9 + (end.tv_nsec - start->tv_nsec);
+}
+
+// Not a pass/fail check, numbers are for the host CPU and only say how the two compare
+static void bench_pack(void)
+{
+    size_t count = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    uint32_t checksum = 0;
+    struct timespec start;
+    double kernel_ns, reference_ns;
+
+    fill_pixels(count, 1);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        pixels[0] = frame;
+        gc9a01_pack_rgb444(expected, pixels, count / 2);
+        checksum += expected[frame];
+    }
+    kernel_ns = elapsed_ns(&start) / BENCH_FRAMES;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        pixels[0] = frame;
+        reference_pack(expected, pixels, count);
+        checksum += expected[frame];
+    }
+    reference_ns = elapsed_ns(&start) / BENCH_FRAMES;
+
+    printf("pack %zu pixels: kernel %.1f us (%.2f ns/pixel, %.0f MB/s in), per pixel reference %.1f us (%.1fx) [%08x]\n",
+           count, kernel_ns / 1000, kernel_ns / count, count * 2 / kernel_ns * 1000,
+           reference_ns / 1000, reference_ns / kernel_ns, checksum);
+}
+
+int main(void)
+{
+    api = fake_display.api;
+
+    RUN_TEST(test_pack_kernel_every_value);
+    RUN_TEST(test_write_even_pixel_counts);
+    RUN_TEST(test_write_odd_pixel_counts);
+    RUN_TEST(test_carry_between_buffers);
+    bench_pack();
+
+    return test_failures ? 1 : 0;
+}
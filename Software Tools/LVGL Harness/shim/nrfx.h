@@ -0,0 +1,6 @@
+#ifndef __HARNESS_NRFX_H__
+#define __HARNESS_NRFX_H__
+
+// system.h pulls this in for pin definitions the display code never uses
+
+#endif // __HARNESS_NRFX_H__
@@ -0,0 +1,34 @@
+#ifndef __HARNESS_BLUETOOTH_H__
+#define __HARNESS_BLUETOOTH_H__
+
+// Enough of the BLE host API for BLE.c to build, the calls themselves are stubs.c
+
+#include <zephyr/types.h>
+#include <zephyr/bluetooth/gap.h>
+
+struct bt_le_adv_param {
+    uint32_t options;
+    uint32_t interval_min;
+    uint32_t interval_max;
+    const void* peer;
+};
+
+struct bt_data {
+    uint8_t type;
+    uint8_t data_len;
+    const uint8_t* data;
+};
+
+#define BT_LE_ADV_PARAM(_options, _int_min, _int_max, _peer) \
+    ((struct bt_le_adv_param[]) { { .options = (_options), .interval_min = (_int_min), .interval_max = (_int_max), .peer = (_peer) } })
+
+#define BT_DATA(_type, _data, _data_len) { .type = (_type), .data_len = (_data_len), .data = (const uint8_t*)(_data) }
+#define BT_DATA_BYTES(_type, _bytes...) BT_DATA(_type, ((uint8_t[]) { _bytes }), sizeof((uint8_t[]) { _bytes }))
+
+typedef void (*bt_ready_cb_t)(int err);
+
+int bt_enable(bt_ready_cb_t cb);
+int bt_le_adv_start(const struct bt_le_adv_param* param, const struct bt_data* ad, size_t ad_len,
+    const struct bt_data* sd, size_t sd_len);
+
+#endif // __HARNESS_BLUETOOTH_H__
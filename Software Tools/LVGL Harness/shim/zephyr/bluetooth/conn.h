@@ -0,0 +1,15 @@
+#ifndef __HARNESS_CONN_H__
+#define __HARNESS_CONN_H__
+
+#include <zephyr/types.h>
+
+struct bt_conn;
+
+struct bt_conn_cb {
+    void (*connected)(struct bt_conn* conn, uint8_t err);
+    void (*disconnected)(struct bt_conn* conn, uint8_t reason);
+};
+
+void bt_conn_cb_register(struct bt_conn_cb* cb);
+
+#endif // __HARNESS_CONN_H__
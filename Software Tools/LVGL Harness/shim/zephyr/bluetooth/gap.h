@@ -0,0 +1,14 @@
+#ifndef __HARNESS_GAP_H__
+#define __HARNESS_GAP_H__
+
+#define BT_DATA_FLAGS               0x01
+#define BT_DATA_UUID128_ALL         0x07
+#define BT_DATA_NAME_COMPLETE       0x09
+
+#define BT_LE_AD_GENERAL            0x02
+#define BT_LE_AD_NO_BREDR           0x04
+
+#define BT_LE_ADV_OPT_CONNECTABLE   (1 << 0)
+#define BT_LE_ADV_OPT_USE_IDENTITY  (1 << 2)
+
+#endif // __HARNESS_GAP_H__
@@ -0,0 +1,15 @@
+#ifndef __HARNESS_UUID_H__
+#define __HARNESS_UUID_H__
+
+#include <zephyr/types.h>
+
+// Little endian bytes, the same as zephyr
+#define BT_UUID_128_ENCODE(w32, w1, w2, w3, w48) \
+    (((w48) >>  0) & 0xFF), (((w48) >>  8) & 0xFF), (((w48) >> 16) & 0xFF), \
+    (((w48) >> 24) & 0xFF), (((w48) >> 32) & 0xFF), (((w48) >> 40) & 0xFF), \
+    (((w3)  >>  0) & 0xFF), (((w3)  >>  8) & 0xFF), \
+    (((w2)  >>  0) & 0xFF), (((w2)  >>  8) & 0xFF), \
+    (((w1)  >>  0) & 0xFF), (((w1)  >>  8) & 0xFF), \
+    (((w32) >>  0) & 0xFF), (((w32) >>  8) & 0xFF), (((w32) >> 16) & 0xFF), (((w32) >> 24) & 0xFF)
+
+#endif // __HARNESS_UUID_H__
@@ -0,0 +1,10 @@
+#ifndef __HARNESS_DISPLAY_H__
+#define __HARNESS_DISPLAY_H__
+
+#include <zephyr/device.h>
+
+int display_blanking_on(const struct device* dev);
+int display_blanking_off(const struct device* dev);
+int display_set_brightness(const struct device* dev, uint8_t brightness);
+
+#endif // __HARNESS_DISPLAY_H__
@@ -0,0 +1,6 @@
+#ifndef __HARNESS_GPIO_H__
+#define __HARNESS_GPIO_H__
+
+#include <zephyr/device.h>
+
+#endif // __HARNESS_GPIO_H__
@@ -0,0 +1,26 @@
+#ifndef __HARNESS_KERNEL_H__
+#define __HARNESS_KERNEL_H__
+
+// Just enough of zephyr's kernel API for the firmware's display code to build on a PC
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+struct k_event {
+    uint32_t events;
+};
+
+uint32_t k_event_post(struct k_event* event, uint32_t events);
+int64_t k_uptime_get(void);
+uint32_t k_uptime_get_32(void);
+uint32_t k_cycle_get_32(void);
+uint64_t k_cyc_to_us_floor64(uint64_t cycles);
+
+#endif // __HARNESS_KERNEL_H__
@@ -0,0 +1,23 @@
+#ifndef __HARNESS_ATOMIC_H__
+#define __HARNESS_ATOMIC_H__
+
+#include <stdbool.h>
+
+// The harness is single threaded, plain loads and stores are enough
+
+typedef long atomic_t;
+
+#define ATOMIC_INIT(i) (i)
+
+static inline long atomic_get(const atomic_t* target) { return *target; }
+static inline long atomic_set(atomic_t* target, long value) { long old = *target; *target = value; return old; }
+static inline long atomic_clear(atomic_t* target) { return atomic_set(target, 0); }
+static inline long atomic_inc(atomic_t* target) { return (*target)++; }
+static inline bool atomic_cas(atomic_t* target, long old_value, long new_value)
+{
+    if (*target != old_value) return false;
+    *target = new_value;
+    return true;
+}
+
+#endif // __HARNESS_ATOMIC_H__
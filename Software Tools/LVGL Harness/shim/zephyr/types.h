@@ -0,0 +1,7 @@
+#ifndef __HARNESS_TYPES_H__
+#define __HARNESS_TYPES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#endif // __HARNESS_TYPES_H__
@@ -0,0 +1,61 @@
+#include <string.h>
+#include <time.h>
+#include <lvgl.h>
+
+#include "harness.h"
+#include "fake_display.h"
+
+#define HOR_RES         240
+#define VER_RES         240
+#define VDB_PIXELS      (HOR_RES * VER_RES * 25 / 100)
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t vdb[2][VDB_PIXELS];
+static lv_disp_drv_t disp_drv;
+
+static uint32_t tick_ms;
+static uint32_t flushed_pixels;
+
+uint32_t harness_tick_ms(void)
+{
+    return tick_ms;
+}
+
+void harness_tick_advance(uint32_t ms)
+{
+    tick_ms += ms;
+}
+
+uint64_t harness_time_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static void test_flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p)
+{
+    flushed_pixels += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+void fake_display_init(void)
+{
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, vdb[0], vdb[1], VDB_PIXELS);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp_drv.flush_cb = test_flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+}
+
+uint32_t fake_display_take_pixels(void)
+{
+    uint32_t pixels = flushed_pixels;
+
+    flushed_pixels = 0;
+    return pixels;
+}
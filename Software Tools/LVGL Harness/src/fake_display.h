@@ -0,0 +1,14 @@
+#ifndef __FAKE_DISPLAY_H__
+#define __FAKE_DISPLAY_H__
+
+#include <stdint.h>
+
+// Headless display for the unit tests, the same size and buffers as the harness's but nothing
+//  that is drawn is kept, only how much of it there was
+
+void fake_display_init(void);
+
+// Pixels flushed since the last call
+uint32_t fake_display_take_pixels(void);
+
+#endif // __FAKE_DISPLAY_H__
@@ -0,0 +1,22 @@
+#ifndef __HARNESS_H__
+#define __HARNESS_H__
+
+#include <stdint.h>
+
+// Simulated time in ms, only moves when the harness advances it
+uint32_t harness_tick_ms(void);
+void harness_tick_advance(uint32_t ms);
+
+// Wall clock in us for timing renders
+uint64_t harness_time_us(void);
+
+// Bring up the real BLE.c (connected) and post the sample notifications through it
+int harness_ble_init(void);
+
+// Post a notification as the phone would, through BLE.c's payload parser
+int harness_ble_notify(const char* appName, const char* title, const char* text, uint32_t timestamp);
+
+// File standing in for the external flash, NULL reads as a blank (erased) flash
+extern const char* harness_flash_path;
+
+#endif // __HARNESS_H__
@@ -0,0 +1,38 @@
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*
+    LVGL v8.4 configuration for the host harness.
+    Mirrors what the gecko_development defconfig sets through zephyr's Kconfig so screens render
+    (and cost) the same as on the watch, anything not listed here is left at LVGL's default.
+*/
+
+#include <stdint.h>
+
+// CONFIG_LV_COLOR_DEPTH_16, CONFIG_LV_COLOR_16_SWAP
+// The swap is kept so the image assets (stored byte swapped for the panel) decode the same
+#define LV_COLOR_DEPTH              16
+#define LV_COLOR_16_SWAP            1
+
+// CONFIG_LV_MEM_SIZE_KILOBYTES, same allocator and budget as the watch
+#define LV_MEM_CUSTOM               0
+#define LV_MEM_SIZE                 (16U * 1024U)
+
+// Zephyr's default refresh period
+#define LV_DISP_DEF_REFR_PERIOD     30
+
+// Ticks come from the harness so runs are repeatable
+#define LV_TICK_CUSTOM              1
+#define LV_TICK_CUSTOM_INCLUDE      "harness.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (harness_tick_ms())
+
+// CONFIG_LV_FONT_MONTSERRAT_14, CONFIG_LV_FONT_MONTSERRAT_24
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_MONTSERRAT_24       1
+#define LV_FONT_DEFAULT             &lv_font_montserrat_14
+
+#define LV_USE_LOG                  0
+#define LV_USE_PERF_MONITOR         0
+#define LV_USE_MEM_MONITOR          0
+
+#endif // LV_CONF_H
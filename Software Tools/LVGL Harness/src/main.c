@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <lvgl.h>
+
+#include "system.h"
+#include "Peripherals/BMA400/taps.h"
+#include "lvgl_layer.h"
+#include "flash_resources.h"
+#include "harness.h"
+#include "png.h"
+
+/*
+    Headless LVGL render harness
+    Builds the firmware's lvgl_layer.c against LVGL with an in-memory display, draws every screen,
+    saves each one as a PNG and reports what drawing it cost. Given a baseline from an earlier run
+    it fails when a screen got more expensive, so UI changes can be checked without a watch.
+*/
+
+#define HOR_RES         240
+#define VER_RES         240
+#define VDB_PIXELS      (HOR_RES * VER_RES * 25 / 100) // CONFIG_LV_Z_VDB_SIZE=25, double buffered
+#define TIMING_RUNS     5   // Render time is the best of this many full redraws
+
+// Allowed growth over the baseline before a screen counts as a regression
+#define AREA_TOLERANCE_PCT  2
+#define TIME_TOLERANCE_PCT  25  // Times depend on the machine, they only warn
+
+typedef struct {
+    const char* name;
+    Screen_Type type;
+} Harness_Screen;
+
+typedef struct {
+    char name[32];
+    uint64_t cold_us;       // Full redraw of the screen
+    uint32_t cold_pixels;   // Pixels flushed by the full redraw
+    uint32_t cold_bytes;    // Bytes those pixels take on the SPI bus
+    uint32_t cold_flushes;
+    uint32_t update_pixels; // Pixels flushed when the screen is refreshed with nothing changed
+} Render_Result;
+
+static const Harness_Screen screens[] = {
+    { "home",                   SCREEN_HOME },
+    { "notification_summary",   SCREEN_NOTIFICATION_SUMMARY },
+    { "notification_detailed",  SCREEN_NOTIFICATION_DETAILED },
+    { "device_status",          SCREEN_DEVICE_STATUS },
+    { "device_brightness",      SCREEN_DEVICE_BRIGHTNESS },
+    { "charging",               SCREEN_CHARGING },
+    { "always_on",              SCREEN_ALWAYS_ON },
+};
+#define SCREEN_COUNT (sizeof(screens) / sizeof(screens[0]))
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t vdb[2][VDB_PIXELS];
+static lv_disp_drv_t disp_drv;
+static lv_color_t framebuffer[HOR_RES * VER_RES];
+
+static uint32_t tick_ms;
+
+// What the flush callback has been handed since the last flush_counters_reset()
+static uint32_t flush_count;
+static uint32_t flush_pixels;
+
+uint32_t harness_tick_ms(void)
+{
+    return tick_ms;
+}
+
+void harness_tick_advance(uint32_t ms)
+{
+    tick_ms += ms;
+}
+
+uint64_t harness_time_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Stands in for the gc9a01 driver, the area lands in the framebuffer instead of going out over SPI
+static void harness_flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p)
+{
+    uint32_t width = lv_area_get_width(area);
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(&framebuffer[y * HOR_RES + area->x1], color_p, width * sizeof(lv_color_t));
+        color_p += width;
+    }
+
+    flush_count++;
+    flush_pixels += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+static void flush_counters_reset(void)
+{
+    flush_count = 0;
+    flush_pixels = 0;
+}
+
+static void harness_display_init(void)
+{
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, vdb[0], vdb[1], VDB_PIXELS);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp_drv.flush_cb = harness_flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+}
+
+static int save_png(const char* dir, const char* name)
+{
+    static uint8_t rgb[HOR_RES * VER_RES * 3];
+    char path[256];
+
+    for (int i = 0; i < HOR_RES * VER_RES; i++)
+    {
+        lv_color32_t c = lv_color_to32(framebuffer[i]);
+        rgb[i * 3] = c.ch.red;
+        rgb[i * 3 + 1] = c.ch.green;
+        rgb[i * 3 + 2] = c.ch.blue;
+    }
+
+    snprintf(path, sizeof(path), "%s/%s.png", dir, name);
+    return png_write_rgb(path, rgb, HOR_RES, VER_RES);
+}
+
+static void render_screen(const Harness_Screen* screen, Render_Result* result)
+{
+    memset(result, 0, sizeof(*result));
+    snprintf(result->name, sizeof(result->name), "%s", screen->name);
+    result->cold_us = UINT64_MAX;
+
+    display_switch_screen(screen->type);
+
+    // Full redraws, as if the screen was just loaded
+    for (int run = 0; run < TIMING_RUNS; run++)
+    {
+        uint64_t start;
+        uint64_t elapsed;
+
+        lv_obj_invalidate(lv_scr_act());
+        flush_counters_reset();
+        start = harness_time_us();
+        lv_refr_now(NULL);
+        elapsed = harness_time_us() - start;
+
+        if (elapsed < result->cold_us) result->cold_us = elapsed;
+    }
+    result->cold_pixels = flush_pixels;
+    result->cold_bytes = flush_pixels * sizeof(lv_color_t);
+    result->cold_flushes = flush_count;
+
+    // The periodic refresh path, nothing on screen changed so ideally nothing is drawn
+    harness_tick_advance(1000);
+    flush_counters_reset();
+    display_switch_screen(SCREEN_ACTIVE);
+    lv_refr_now(NULL);
+    result->update_pixels = flush_pixels;
+}
+
+static int baseline_write(const char* path, const Render_Result* results, size_t count)
+{
+    FILE* file = fopen(path, "w");
+
+    if (!file) return -errno;
+
+    fprintf(file, "screen,cold_us,cold_pixels,cold_bytes,cold_flushes,update_pixels\n");
+    for (size_t i = 0; i < count; i++)
+    {
+        fprintf(file, "%s,%llu,%u,%u,%u,%u\n", results[i].name, (unsigned long long)results[i].cold_us,
+            results[i].cold_pixels, results[i].cold_bytes, results[i].cold_flushes, results[i].update_pixels);
+    }
+
+    fclose(file);
+    return 0;
+}
+
+static bool exceeds(uint64_t value, uint64_t baseline, uint32_t tolerance_pct)
+{
+    return value * 100 > baseline * (100 + tolerance_pct);
+}
+
+// Returns the number of screens that got more expensive to draw, negative on a file error
+static int baseline_check(const char* path, const Render_Result* results, size_t count)
+{
+    FILE* file = fopen(path, "r");
+    char line[256];
+    int regressions = 0;
+
+    if (!file) return -errno;
+
+    while (fgets(line, sizeof(line), file))
+    {
+        Render_Result base;
+        unsigned long long cold_us;
+        const Render_Result* current = NULL;
+
+        if (sscanf(line, "%31[^,],%llu,%u,%u,%u,%u", base.name, &cold_us, &base.cold_pixels,
+                &base.cold_bytes, &base.cold_flushes, &base.update_pixels) != 6) continue; // Header
+        base.cold_us = cold_us;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (strcmp(results[i].name, base.name) == 0) current = &results[i];
+        }
+        if (!current)
+        {
+            printf("%-24s " ANSI_COLOR_YELLOW "in the baseline but no longer rendered" ANSI_COLOR_RESET "\n", base.name);
+            continue;
+        }
+
+        if (exceeds(current->cold_bytes, base.cold_bytes, AREA_TOLERANCE_PCT))
+        {
+            printf("%-24s " ANSI_COLOR_RED "full redraw flushes %u bytes, baseline %u" ANSI_COLOR_RESET "\n",
+                base.name, current->cold_bytes, base.cold_bytes);
+            regressions++;
+        }
+        if (exceeds(current->update_pixels, base.update_pixels, AREA_TOLERANCE_PCT))
+        {
+            printf("%-24s " ANSI_COLOR_RED "unchanged refresh redraws %u px, baseline %u" ANSI_COLOR_RESET "\n",
+                base.name, current->update_pixels, base.update_pixels);
+            regressions++;
+        }
+        // No time in the baseline (0), it came from another machine and only the areas are compared
+        if (base.cold_us && exceeds(current->cold_us, base.cold_us, TIME_TOLERANCE_PCT))
+        {
+            printf("%-24s " ANSI_COLOR_YELLOW "full redraw took %llu us, baseline %llu us" ANSI_COLOR_RESET "\n",
+                base.name, (unsigned long long)current->cold_us, cold_us);
+        }
+    }
+
+    fclose(file);
+    return regressions;
+}
+
+static void usage(const char* program)
+{
+    printf("Usage: %s [-o output_dir] [-b baseline.csv] [-w new_baseline.csv] [-r resources.bin]\n", program);
+    printf("  -o  Where the screen PNGs go (default ./out)\n");
+    printf("  -b  Fail if any screen costs more to draw than in this baseline\n");
+    printf("  -w  Save this run's numbers as a baseline\n");
+    printf("  -r  Draw with this Resource Packer image as the external flash (default blank)\n");
+}
+
+int main(int argc, char** argv)
+{
+    const char* output_dir = "out";
+    const char* baseline_path = NULL;
+    const char* write_path = NULL;
+    Render_Result results[SCREEN_COUNT];
+    int err;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) output_dir = argv[++i];
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) baseline_path = argv[++i];
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) write_path = argv[++i];
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) harness_flash_path = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (mkdir(output_dir, 0755) != 0 && errno != EEXIST)
+    {
+        printf(ANSI_COLOR_RED "Could not create %s" ANSI_COLOR_RESET "\n", output_dir);
+        return 1;
+    }
+
+    harness_display_init();
+    if (harness_ble_init() != 0)
+    {
+        printf(ANSI_COLOR_RED "Could not post the sample notifications" ANSI_COLOR_RESET "\n");
+        return 1;
+    }
+    flash_resources_init();
+    display_lvgl_init();
+
+    printf("\n%-24s %10s %10s %10s %8s %10s\n", "Screen", "Render us", "Pixels", "Bytes", "Flushes", "Update px");
+    for (size_t i = 0; i < SCREEN_COUNT; i++)
+    {
+        render_screen(&screens[i], &results[i]);
+        printf("%-24s %10llu %10u %10u %8u %10u\n", results[i].name, (unsigned long long)results[i].cold_us,
+            results[i].cold_pixels, results[i].cold_bytes, results[i].cold_flushes, results[i].update_pixels);
+
+        // The framebuffer still holds the full redraw, the unchanged refresh only ever adds to it
+        if (save_png(output_dir, screens[i].name) != 0)
+        {
+            printf(ANSI_COLOR_RED "Could not write %s/%s.png" ANSI_COLOR_RESET "\n", output_dir, screens[i].name);
+        }
+    }
+
+    // Every screen has been built once now, this is the heap a session visiting all of them needs
+    printf("\n");
+    display_print_heap_report();
+    flash_resources_print_report();
+
+    if (write_path)
+    {
+        err = baseline_write(write_path, results, SCREEN_COUNT);
+        if (err) printf(ANSI_COLOR_RED "Could not write %s" ANSI_COLOR_RESET "\n", write_path);
+        else printf("\nBaseline written to %s\n", write_path);
+    }
+
+    if (baseline_path)
+    {
+        err = baseline_check(baseline_path, results, SCREEN_COUNT);
+        if (err < 0)
+        {
+            printf(ANSI_COLOR_RED "Could not read %s" ANSI_COLOR_RESET "\n", baseline_path);
+            return 1;
+        }
+        if (err > 0)
+        {
+            printf("\n" ANSI_COLOR_RED "%d render regression(s) against %s" ANSI_COLOR_RESET "\n", err, baseline_path);
+            return 1;
+        }
+        printf("\n" ANSI_COLOR_GREEN "No render regressions against %s" ANSI_COLOR_RESET "\n", baseline_path);
+    }
+
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include "system.h"
+#include "clock.h"
+#include "BLE/BLE.h"
+#include "BLE/SmartWatchService.h"
+#include "Peripherals/Power/battery.h"
+#include "Peripherals/ExternalFlash/externalFlash.h"
+#include "gc9a01.h"
+#include "harness.h"
+
+/*
+    Stand-ins for everything lvgl_layer.c reaches outside of LVGL and BLE.c. Values are fixed so
+    every run draws exactly the same screens.
+*/
+
+const struct device harness_display = { .name = "gc9a01" };
+
+struct k_event userInteractionEvent;
+
+// Sample notifications, the first one (what the detailed screen opens) is the newest and long enough
+//  to page
+typedef struct {
+    const char* appName;
+    const char* title;
+    const char* text;
+    uint32_t timestamp;
+} Sample_Notification;
+
+static const Sample_Notification sample_notifications[] = {
+    { "Gmail", "email@gmail.com", "This is an email", 1721259614 },
+    { "Textra", "Beany Boy", "I like beans....", 1721259714 },
+    { "Outlook", "Team Calendar",
+      "Reminder: design review moved to Thursday at 3 PM in the large conference room. Please bring "
+      "the latest board revision, the power measurements from last week and any open questions on "
+      "the display driver so we can close them out before the next build.", 1721259814 },
+};
+
+static struct SmartWatchService_cb* sws_callbacks;
+static struct bt_conn_cb* conn_callbacks;
+
+uint32_t k_event_post(struct k_event* event, uint32_t events)
+{
+    uint32_t previous = event->events;
+    event->events |= events;
+    return previous;
+}
+
+int64_t k_uptime_get(void)
+{
+    return harness_tick_ms();
+}
+
+uint32_t k_uptime_get_32(void)
+{
+    return harness_tick_ms();
+}
+
+// Cycles are microseconds of wall time on the host
+uint32_t k_cycle_get_32(void)
+{
+    return (uint32_t)harness_time_us();
+}
+
+uint64_t k_cyc_to_us_floor64(uint64_t cycles)
+{
+    return cycles;
+}
+
+// 10:09 is the usual watch face time, every digit shape shows up
+void getTime(struct tm** timeObject)
+{
+    static struct tm fixed = { .tm_year = 124, .tm_mon = 6, .tm_mday = 17, .tm_hour = 10, .tm_min = 9 };
+    *timeObject = &fixed;
+}
+
+int batteryReadVoltage(void)
+{
+    return 3870; // mV
+}
+
+int display_blanking_on(const struct device* dev)
+{
+    return 0;
+}
+
+int display_blanking_off(const struct device* dev)
+{
+    return 0;
+}
+
+int display_set_brightness(const struct device* dev, uint8_t brightness)
+{
+    return 0;
+}
+
+// No TE line on the host, the firmware then draws without animations like a board without te-gpios
+int gc9a01_vsync_callback_set(const struct device* dev, gc9a01_vsync_cb_t cb, void* user_data)
+{
+    return -ENOTSUP;
+}
+
+int gc9a01_always_on_enter(const struct device* dev, uint16_t start_row, uint16_t end_row)
+{
+    return 0;
+}
+
+int gc9a01_always_on_exit(const struct device* dev)
+{
+    return 0;
+}
+
+int gc9a01_scroll_area_set(const struct device* dev, uint16_t top_fixed, uint16_t scroll_rows)
+{
+    return 0;
+}
+
+int gc9a01_scroll_to(const struct device* dev, uint16_t offset)
+{
+    return 0;
+}
+
+// BLE.c is built as it is, the stack underneath it does nothing
+int bt_enable(bt_ready_cb_t cb)
+{
+    return 0;
+}
+
+int bt_le_adv_start(const struct bt_le_adv_param* param, const struct bt_data* ad, size_t ad_len,
+    const struct bt_data* sd, size_t sd_len)
+{
+    return 0;
+}
+
+void bt_conn_cb_register(struct bt_conn_cb* cb)
+{
+    conn_callbacks = cb;
+}
+
+int SmartWatchService_init(struct SmartWatchService_cb* callbacks)
+{
+    sws_callbacks = callbacks;
+    return 0;
+}
+
+void setEpochTime(uint64_t newEpochTime)
+{
+}
+
+static size_t payload_field(uint8_t* payload, size_t pos, uint8_t type, const void* value, uint16_t len)
+{
+    payload[pos] = type;
+    payload[pos + 1] = len >> 8;
+    payload[pos + 2] = len & 0xFF;
+    memcpy(&payload[pos + SWS_FIELD_HEADER_SIZE], value, len);
+    return pos + SWS_FIELD_HEADER_SIZE + len;
+}
+
+int harness_ble_notify(const char* appName, const char* title, const char* text, uint32_t timestamp)
+{
+    uint8_t payload[SWS_NOTIFICATION_MAX_SIZE];
+    uint8_t stamp[4] = { timestamp >> 24, timestamp >> 16, timestamp >> 8, timestamp };
+    size_t pos = 0;
+
+    if (!sws_callbacks) return -ENODEV;
+    if (1 + 4 * SWS_FIELD_HEADER_SIZE + strlen(appName) + strlen(title) + strlen(text) + sizeof(stamp) > sizeof(payload)) return -EMSGSIZE;
+
+    payload[pos++] = SWS_NOTIFICATION_VERSION;
+    pos = payload_field(payload, pos, SWS_FIELD_APP, appName, strlen(appName));
+    pos = payload_field(payload, pos, SWS_FIELD_TITLE, title, strlen(title));
+    pos = payload_field(payload, pos, SWS_FIELD_BODY, text, strlen(text));
+    pos = payload_field(payload, pos, SWS_FIELD_TIMESTAMP, stamp, sizeof(stamp));
+    sws_callbacks->notification_cb((char*)payload, pos);
+    return 0;
+}
+
+int harness_ble_init(void)
+{
+    int err = BLE_init();
+
+    if (err) return err;
+    conn_callbacks->connected(NULL, 0);
+
+    for (size_t i = 0; i < sizeof(sample_notifications) / sizeof(sample_notifications[0]); i++)
+    {
+        const Sample_Notification* sample = &sample_notifications[i];
+
+        err = harness_ble_notify(sample->appName, sample->title, sample->text, sample->timestamp);
+        if (err) return err;
+    }
+    return 0;
+}
+
+const char* harness_flash_path;
+
+// Past the end of the file reads as erased flash, like the real part
+int externalFlashRead(uint32_t address, void* data, size_t length)
+{
+    FILE* file;
+    size_t read = 0;
+
+    if (harness_flash_path)
+    {
+        file = fopen(harness_flash_path, "rb");
+        if (!file) return -EIO;
+        if (fseek(file, address, SEEK_SET) == 0) read = fread(data, 1, length, file);
+        fclose(file);
+    }
+    memset((uint8_t*)data + read, 0xFF, length - read);
+    return 0;
+}
@@ -0,0 +1,229 @@
+// CONFIG_GECKO_DETAILED_BODY_PAGED: a body's line breaks are worked out once and cached per
+//  notification, the label only ever holds the lines of the page showing
+
+#include "lvgl_layer.c"
+#include "harness.h"
+#include "fake_display.h"
+#include "test.h"
+
+// Single spaces and no word wider than the label, so every break falls on a space
+static const char long_body[] =
+    "The build server finished the nightly firmware run with two warnings in the display driver "
+    "and one flaky power test. Logs are attached to the ticket, the warnings look harmless but "
+    "somebody should check the round mask change before the release branch is cut on Friday. "
+    "Please reply here if you are taking it so nobody else picks it up in the meantime.";
+
+// Empty store and break cache, the detailed screen is built since its label's font sets the breaks
+static void store_reset(void)
+{
+    screen_get(SCREEN_NOTIFICATION_DETAILED);
+    clearNotifications();
+    memset(body_layouts, 0, sizeof(body_layouts));
+    body_layout_clock = 0;
+}
+
+// Through the summary screen, like a tap on a roller row would
+static void open_detailed(uint16_t row)
+{
+    display_switch_screen(SCREEN_NOTIFICATION_SUMMARY);
+    lv_roller_set_selected(notificationScreenObj.roller, row, LV_ANIM_OFF);
+    display_switch_screen(SCREEN_NOTIFICATION_DETAILED);
+}
+
+static const char* page_counter(void)
+{
+    return lv_label_get_text(detailedNotificationScreenObj.message_page_label);
+}
+
+static bool page_counter_shown(void)
+{
+    return !lv_obj_has_flag(detailedNotificationScreenObj.message_page_label, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void test_lines_cover_body_and_fit(void)
+{
+    const lv_obj_t* label = detailedNotificationScreenObj.message_body_label;
+    const lv_font_t* font;
+    lv_coord_t letter_space;
+    const Notification* notification;
+    const Body_Layout* layout;
+
+    store_reset();
+    CHECK(harness_ble_notify("Jenkins", "Nightly", long_body, 1000) == 0);
+    open_detailed(0);
+
+    notification = &activeNotifications[0];
+    layout = body_layout_get(notification);
+    font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    letter_space = lv_obj_get_style_text_letter_space(label, LV_PART_MAIN);
+
+    CHECK(layout->line_count > DETAILED_PAGE_LINES);
+    CHECK(layout->line_starts[0] == 0);
+    CHECK(layout->line_starts[layout->line_count] == strlen(long_body));
+    for (uint16_t line = 0; line < layout->line_count; line++)
+    {
+        uint16_t start = layout->line_starts[line];
+        uint16_t end = layout->line_starts[line + 1];
+
+        CHECK(end > start);
+        while (end > start && notification->text[end - 1] == ' ') end--;
+        CHECK(lv_txt_get_width(&notification->text[start], end - start, font, letter_space, LV_TEXT_FLAG_NONE) <= DETAILED_BODY_WIDTH);
+    }
+}
+
+static void test_pages_rebuild_body(void)
+{
+    char joined[sizeof(long_body) + DETAILED_MAX_LINES];
+    char counter[12];
+    size_t used = 0;
+    uint16_t pages;
+
+    store_reset();
+    CHECK(harness_ble_notify("Jenkins", "Nightly", long_body, 1000) == 0);
+    open_detailed(0);
+    pages = body_page_count(body_layout_get(&activeNotifications[0]));
+    CHECK(pages > 1);
+
+    // Tap through every page, the label never holds more than a page of lines
+    for (uint16_t page = 0; page < pages; page++)
+    {
+        const char* text = lv_label_get_text(detailedNotificationScreenObj.message_body_label);
+        uint16_t lines = 1;
+
+        for (const char* c = text; *c; c++) lines += (*c == '\n');
+        CHECK(lines <= DETAILED_PAGE_LINES);
+
+        snprintf(counter, sizeof(counter), "%u/%u", page + 1, pages);
+        CHECK(strcmp(page_counter(), counter) == 0);
+        CHECK(page_counter_shown());
+
+        used += snprintf(&joined[used], sizeof(joined) - used, "%s%s", used ? " " : "", text);
+        CHECK(detailed_page_next() == (page + 1 < pages));
+    }
+
+    // Lines are cut at spaces, putting them back together with one gives the body back
+    for (size_t i = 0; i < used; i++)
+    {
+        if (joined[i] == '\n') joined[i] = ' ';
+    }
+    CHECK(strcmp(joined, long_body) == 0);
+
+    // Stays on the last page
+    snprintf(counter, sizeof(counter), "%u/%u", pages, pages);
+    CHECK(strcmp(page_counter(), counter) == 0);
+}
+
+static void test_short_body_single_page(void)
+{
+    store_reset();
+    CHECK(harness_ble_notify("Textra", "Beany Boy", "I like beans....", 1000) == 0);
+    open_detailed(0);
+
+    CHECK(strcmp(lv_label_get_text(detailedNotificationScreenObj.message_body_label), "I like beans....") == 0);
+    CHECK(!page_counter_shown());
+    CHECK(!detailed_page_next());
+}
+
+static void test_page_kept_on_refresh_reset_on_reopen(void)
+{
+    store_reset();
+    CHECK(harness_ble_notify("Jenkins", "Nightly", long_body, 1000) == 0);
+    open_detailed(0);
+    CHECK(detailed_page_next());
+    CHECK(detailed_page == 1);
+
+    // A refresh of the screen that is up (new notification elsewhere, minute tick) keeps the page
+    display_switch_screen(SCREEN_ACTIVE);
+    CHECK(detailed_page == 1);
+
+    // Coming back to it from the summary starts over
+    open_detailed(0);
+    CHECK(detailed_page == 0);
+    CHECK(strncmp(page_counter(), "1/", 2) == 0);
+}
+
+static void test_breaks_cached_per_notification(void)
+{
+    Notification* notification;
+    const Body_Layout* layout;
+    uint16_t line_count;
+    uint16_t first_break;
+
+    store_reset();
+    CHECK(harness_ble_notify("Jenkins", "Nightly", long_body, 1000) == 0);
+    open_detailed(0);
+
+    notification = &activeNotifications[0];
+    layout = body_layout_get(notification);
+    line_count = layout->line_count;
+    first_break = layout->line_starts[1];
+
+    // Only laid out the first time, a body that changed under the same id is not looked at again
+    memset(notification->text, 0, sizeof(notification->text));
+    CHECK(body_layout_get(notification) == layout);
+    CHECK(layout->line_count == line_count);
+    CHECK(layout->line_starts[1] == first_break);
+
+    // Opening it again hits the cache too, its lines still come from the breaks worked out before
+    memcpy(notification->text, long_body, sizeof(long_body));
+    open_detailed(0);
+    CHECK(body_layout_get(notification) == layout);
+    CHECK(layout->line_count == line_count);
+}
+
+static void test_least_recently_opened_evicted(void)
+{
+    Notification notifications[MAX_NOTIFICATION_COUNT + 1];
+    const Body_Layout* first;
+
+    store_reset();
+    for (uint8_t i = 0; i < MAX_NOTIFICATION_COUNT + 1; i++)
+    {
+        memset(&notifications[i], 0, sizeof(notifications[i]));
+        notifications[i].id = 1000 + i;
+        snprintf(notifications[i].text, sizeof(notifications[i].text), "Body %u", i);
+    }
+
+    // Fill the cache, then open the first again so the second is now the oldest
+    for (uint8_t i = 0; i < MAX_NOTIFICATION_COUNT; i++) body_layout_get(&notifications[i]);
+    first = body_layout_get(&notifications[0]);
+
+    body_layout_get(&notifications[MAX_NOTIFICATION_COUNT]);
+    CHECK(body_layout_get(&notifications[0]) == first);
+    for (uint8_t i = 0; i < MAX_NOTIFICATION_COUNT; i++)
+    {
+        CHECK(body_layouts[i].id != notifications[1].id);
+    }
+}
+
+static void test_lines_capped(void)
+{
+    Notification notification = { .id = 2000 };
+    const Body_Layout* layout;
+
+    store_reset();
+    for (size_t i = 0; i + 2 < sizeof(notification.text); i += 2) memcpy(&notification.text[i], "a\n", 2);
+    layout = body_layout_get(&notification);
+
+    CHECK(layout->line_count == DETAILED_MAX_LINES);
+    CHECK(layout->line_starts[DETAILED_MAX_LINES] == 2 * DETAILED_MAX_LINES);
+    CHECK(body_page_count(layout) == DETAILED_MAX_LINES / DETAILED_PAGE_LINES + 1);
+}
+
+int main(void)
+{
+    fake_display_init();
+    if (harness_ble_init() != 0) return 2;
+    flash_resources_init();
+    display_lvgl_init();
+
+    RUN_TEST(test_lines_cover_body_and_fit);
+    RUN_TEST(test_pages_rebuild_body);
+    RUN_TEST(test_short_body_single_page);
+    RUN_TEST(test_page_kept_on_refresh_reset_on_reopen);
+    RUN_TEST(test_breaks_cached_per_notification);
+    RUN_TEST(test_least_recently_opened_evicted);
+    RUN_TEST(test_lines_capped);
+
+    return test_failures ? 1 : 0;
+}
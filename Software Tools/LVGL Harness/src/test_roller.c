@@ -0,0 +1,159 @@
+// Notification roller model: the options string is patched row by row from the store's add/remove
+//  deltas and always has to read the same as one rebuilt from scratch
+
+#include <stdlib.h>
+#include "lvgl_layer.c"
+#include "harness.h"
+#include "fake_display.h"
+#include "test.h"
+
+// Starting point of a freshly built summary screen, with an empty store
+static void roller_reset(void)
+{
+    clearNotifications();
+    memset(&roller_model, 0, sizeof(roller_model));
+    roller_model.revision = notificationRevision - 1;
+    strcpy(notification_roller_buffer, ROLLER_TAIL);
+}
+
+// What the old code built on every visit: every app name in store order, then the tail
+static bool roller_matches_store(void)
+{
+    char expected[sizeof(notification_roller_buffer)];
+    size_t used = 0;
+
+    if (roller_model.count != notificationCount) return false;
+    for (uint8_t i = 0; i < notificationCount; i++)
+    {
+        if (roller_model.ids[i] != activeNotifications[i].id) return false;
+        used += snprintf(&expected[used], sizeof(expected) - used, "%s\n", activeNotifications[i].appName);
+    }
+    snprintf(&expected[used], sizeof(expected) - used, "%s", ROLLER_TAIL);
+    return strcmp(notification_roller_buffer, expected) == 0;
+}
+
+static void notify(const char* appName, uint32_t timestamp)
+{
+    CHECK(harness_ble_notify(appName, "Title", "Body", timestamp) == 0);
+}
+
+static void test_no_change_no_sync(void)
+{
+    // Built showing ROLLER_EMPTY, an empty store has no rows to add to it
+    roller_reset();
+    CHECK(!roller_model_sync());
+    CHECK(roller_matches_store());
+
+    // Nothing happened to the store, nothing to do and the roller keeps its options
+    notify("Gmail", 100);
+    CHECK(roller_model_sync());
+    CHECK(!roller_model_sync());
+    CHECK(roller_matches_store());
+}
+
+static void test_rows_in_timestamp_order(void)
+{
+    roller_reset();
+    notify("Gmail", 100);
+    notify("Textra", 300);
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+
+    // Older than the newest one, lands between the two
+    notify("Outlook", 200);
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+    CHECK(strcmp(notification_roller_buffer, "Textra\nOutlook\nGmail\n" ROLLER_TAIL) == 0);
+}
+
+static void test_removed_rows_dropped(void)
+{
+    roller_reset();
+    notify("A", 100);
+    notify("B", 200);
+    notify("C", 300);
+    notify("D", 400);
+    CHECK(roller_model_sync());
+
+    clearNotification(1);   // Middle
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+
+    clearNotification(0);   // First
+    clearNotification(notificationCount - 1); // Last, two removes in one sync
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+    CHECK(strcmp(notification_roller_buffer, "B\n" ROLLER_TAIL) == 0);
+
+    clearNotifications();
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+    CHECK(strcmp(notification_roller_buffer, ROLLER_TAIL) == 0);
+}
+
+static void test_full_store_drops_oldest(void)
+{
+    roller_reset();
+    for (uint32_t i = 0; i < MAX_NOTIFICATION_COUNT; i++) notify("Old", 100 + i);
+    CHECK(roller_model_sync());
+
+    // The oldest goes and the new one is added in the same sync
+    notify("New", 1000);
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+    CHECK(roller_model.count == MAX_NOTIFICATION_COUNT);
+}
+
+static void test_longest_names_fit(void)
+{
+    char name[MAX_LENGTH_APP_NAME];
+
+    roller_reset();
+    memset(name, 'W', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    for (uint32_t i = 0; i < MAX_NOTIFICATION_COUNT; i++) notify(name, 100 + i);
+    CHECK(roller_model_sync());
+    CHECK(roller_matches_store());
+}
+
+// Adds and removes in any mix, synced every few changes like screen visits would be
+static void test_random_deltas_match_rebuild(void)
+{
+    static const char* const names[] = { "Gmail", "Textra", "Outlook", "Slack", "Calendar", "X" };
+    int mismatches = 0;
+
+    srand(1);
+    roller_reset();
+    for (int step = 0; step < 2000; step++)
+    {
+        int op = rand() % 10;
+
+        if (op < 6) notify(names[rand() % 6], rand() % 1000);
+        else if (op < 9 && notificationCount) clearNotification(rand() % notificationCount);
+        else if (op == 9) clearNotifications();
+
+        if (rand() % 3 == 0)
+        {
+            roller_model_sync();
+            if (!roller_matches_store()) mismatches++;
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+int main(void)
+{
+    fake_display_init();
+    if (harness_ble_init() != 0) return 2;
+    flash_resources_init();
+    display_lvgl_init();
+
+    RUN_TEST(test_no_change_no_sync);
+    RUN_TEST(test_rows_in_timestamp_order);
+    RUN_TEST(test_removed_rows_dropped);
+    RUN_TEST(test_full_store_drops_oldest);
+    RUN_TEST(test_longest_names_fit);
+    RUN_TEST(test_random_deltas_match_rebuild);
+
+    return test_failures ? 1 : 0;
+}
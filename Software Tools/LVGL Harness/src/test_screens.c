@@ -0,0 +1,172 @@
+// Screen lifecycle: screens are built the first time they are shown, the rarely used (transient) ones
+//  are deleted again once they have been out of sight for SCREEN_TEARDOWN_IDLE_MS or the watch sleeps
+
+#include "lvgl_layer.c"
+#include "harness.h"
+#include "fake_display.h"
+#include "test.h"
+
+static bool built(Screen_Type type)
+{
+    return *screen_defs[type].lvgl_object != NULL;
+}
+
+// Let LVGL's timers run after some time has passed, like the display thread would
+static void idle(uint32_t ms)
+{
+    harness_tick_advance(ms);
+    lv_timer_handler();
+}
+
+// LVGL heap in use, without the draw buffers LVGL keeps around to reuse
+static uint32_t heap_used(void)
+{
+    Display_Heap_Stats stats;
+
+    lv_mem_buf_free_all();
+    display_get_heap_stats(&stats);
+    return stats.used;
+}
+
+// Runs first, straight after display_lvgl_init()
+static void test_only_home_built_at_init(void)
+{
+    Display_Heap_Stats stats;
+
+    display_get_heap_stats(&stats);
+    CHECK(built(SCREEN_HOME));
+    CHECK(stats.screen_bytes[SCREEN_HOME] > 0);
+    for (Screen_Type type = SCREEN_HOME + 1; type < SCREEN_TYPE_COUNT; type++)
+    {
+        CHECK(!built(type));
+        CHECK(stats.screen_bytes[type] == 0);
+    }
+}
+
+static void test_built_on_first_show(void)
+{
+    Display_Heap_Stats stats;
+
+    display_switch_screen(SCREEN_DEVICE_STATUS);
+    display_get_heap_stats(&stats);
+    CHECK(built(SCREEN_DEVICE_STATUS));
+    CHECK(lv_scr_act() == deviceScreenObj.lvgl_object);
+    CHECK(stats.screen_bytes[SCREEN_DEVICE_STATUS] > 0);
+
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+}
+
+static void test_transient_freed_after_idle(void)
+{
+    display_switch_screen(SCREEN_DEVICE_STATUS);
+    display_switch_screen(SCREEN_HOME);
+
+    idle(SCREEN_TEARDOWN_IDLE_MS - 1);
+    CHECK(built(SCREEN_DEVICE_STATUS));
+
+    idle(1);
+    CHECK(!built(SCREEN_DEVICE_STATUS));
+    CHECK(deviceScreenObj.bluetooth_label == NULL);
+
+    // Nothing left to free, the timer stops rather than waking the display thread for nothing
+    CHECK(screen_teardown_timer->paused);
+}
+
+static void test_teardown_gives_heap_back(void)
+{
+    uint32_t before;
+
+    // A first round for anything LVGL only allocates once (styles, font caches)
+    display_switch_screen(SCREEN_DEVICE_BRIGHTNESS);
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+
+    before = heap_used();
+    display_switch_screen(SCREEN_DEVICE_BRIGHTNESS);
+    CHECK(heap_used() > before);
+
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+    CHECK(!built(SCREEN_DEVICE_BRIGHTNESS));
+    CHECK(heap_used() == before);
+}
+
+static void test_showing_screen_kept(void)
+{
+    // Status -> brightness, the countdown started when status was left goes off while brightness is up
+    display_switch_screen(SCREEN_DEVICE_STATUS);
+    display_switch_screen(SCREEN_DEVICE_BRIGHTNESS);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+
+    CHECK(!built(SCREEN_DEVICE_STATUS));
+    CHECK(built(SCREEN_DEVICE_BRIGHTNESS));
+    CHECK(lv_scr_act() == deviceBrightnessScreenObj.lvgl_object);
+
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+    CHECK(!built(SCREEN_DEVICE_BRIGHTNESS));
+}
+
+static void test_non_transient_kept(void)
+{
+    display_switch_screen(SCREEN_NOTIFICATION_SUMMARY);
+    display_switch_screen(SCREEN_NOTIFICATION_DETAILED);
+    display_switch_screen(SCREEN_CHARGING);
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+
+    CHECK(!built(SCREEN_CHARGING));
+    CHECK(built(SCREEN_HOME));
+    CHECK(built(SCREEN_NOTIFICATION_SUMMARY));
+    CHECK(built(SCREEN_NOTIFICATION_DETAILED));
+}
+
+static void test_rebuilt_on_next_show(void)
+{
+    display_switch_screen(SCREEN_DEVICE_STATUS);
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+    CHECK(!built(SCREEN_DEVICE_STATUS));
+
+    // A fresh screen, filled in like it had never been built
+    display_switch_screen(SCREEN_DEVICE_STATUS);
+    CHECK(built(SCREEN_DEVICE_STATUS));
+    CHECK(lv_scr_act() == deviceScreenObj.lvgl_object);
+    CHECK(strcmp(lv_label_get_text(deviceScreenObj.bluetooth_label), "Bluetooth Status: Connected") == 0);
+
+    display_switch_screen(SCREEN_HOME);
+    idle(SCREEN_TEARDOWN_IDLE_MS);
+}
+
+static void test_sleep_tears_down(void)
+{
+    // No waiting for the timer, everything transient goes as the display sleeps
+    display_switch_screen(SCREEN_CHARGING);
+    display_sleep();
+    CHECK(!built(SCREEN_CHARGING));
+    CHECK(built(SCREEN_HOME));
+
+    display_wake();
+    CHECK(get_active_screen() == SCREEN_HOME);
+    CHECK(!built(SCREEN_CHARGING));
+}
+
+int main(void)
+{
+    fake_display_init();
+    if (harness_ble_init() != 0) return 2;
+    flash_resources_init();
+    display_lvgl_init();
+
+    RUN_TEST(test_only_home_built_at_init);
+    RUN_TEST(test_built_on_first_show);
+    RUN_TEST(test_transient_freed_after_idle);
+    RUN_TEST(test_teardown_gives_heap_back);
+    RUN_TEST(test_showing_screen_kept);
+    RUN_TEST(test_non_transient_kept);
+    RUN_TEST(test_rebuilt_on_next_show);
+    RUN_TEST(test_sleep_tears_down);
+
+    return test_failures ? 1 : 0;
+}
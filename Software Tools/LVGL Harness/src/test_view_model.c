@@ -0,0 +1,117 @@
+// View model: screen updates only reach LVGL when a widget's value really changed, so refreshing a
+//  screen with nothing new on it draws nothing
+
+#include "lvgl_layer.c"
+#include "harness.h"
+#include "fake_display.h"
+#include "test.h"
+
+// Show a screen and draw all of it, so the next refresh starts from a clean display
+static void show(Screen_Type type)
+{
+    display_switch_screen(type);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    fake_display_take_pixels();
+}
+
+// Pixels the next refresh draws
+static uint32_t redraw(void)
+{
+    lv_refr_now(NULL);
+    return fake_display_take_pixels();
+}
+
+static void test_unchanged_refresh_draws_nothing(void)
+{
+    static const Screen_Type types[] = {
+        SCREEN_HOME, SCREEN_NOTIFICATION_SUMMARY, SCREEN_NOTIFICATION_DETAILED, SCREEN_DEVICE_STATUS,
+        SCREEN_DEVICE_BRIGHTNESS, SCREEN_CHARGING,
+    };
+
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+    {
+        show(types[i]);
+        display_switch_screen(SCREEN_ACTIVE);
+        CHECK(redraw() == 0);
+    }
+}
+
+static void test_setters_skip_same_value(void)
+{
+    lv_obj_t* label;
+
+    show(SCREEN_DEVICE_STATUS);
+    label = deviceScreenObj.bluetooth_label;
+
+    view_set_text(label, lv_label_get_text(label));
+    view_set_hidden(label, false);
+    view_load_screen(deviceScreenObj.lvgl_object);
+    CHECK(redraw() == 0);
+
+    view_set_text(label, "Bluetooth Status: Changed");
+    CHECK(redraw() > 0);
+    view_set_hidden(label, true);
+    CHECK(redraw() > 0);
+    view_set_hidden(label, false);
+    redraw();
+}
+
+static void test_change_redraws_only_its_widget(void)
+{
+    Display_Refresh_Stats stats;
+    uint32_t pixels;
+
+    show(SCREEN_DEVICE_STATUS);
+    bluetoothConnected = false;
+    display_switch_screen(SCREEN_ACTIVE);
+    pixels = redraw();
+    bluetoothConnected = true;
+
+    // One label's worth, nowhere near the whole screen
+    CHECK(pixels > 0);
+    CHECK(pixels < 240 * 40);
+
+    // The monitor callback saw the same refresh
+    display_get_refresh_stats(&stats);
+    CHECK(stats.last_pixels == pixels);
+
+    display_switch_screen(SCREEN_ACTIVE);
+    redraw();
+}
+
+static void test_minute_tick_redraws_changed_digit(void)
+{
+    struct tm* now;
+    uint32_t pixels;
+
+    show(SCREEN_HOME);
+    getTime(&now);
+
+    // 10:09 -> 10:10, only the two minute digits change
+    now->tm_min = 10;
+    display_switch_screen(SCREEN_ACTIVE);
+    pixels = redraw();
+    now->tm_min = 9;
+
+    CHECK(pixels > 0);
+    CHECK(pixels < 240 * 240 / 8);
+
+    display_switch_screen(SCREEN_ACTIVE);
+    redraw();
+}
+
+int main(void)
+{
+    fake_display_init();
+    if (harness_ble_init() != 0) return 2;
+    flash_resources_init();
+    display_lvgl_init();
+
+    RUN_TEST(test_unchanged_refresh_draws_nothing);
+    RUN_TEST(test_setters_skip_same_value);
+    RUN_TEST(test_change_redraws_only_its_widget);
+    RUN_TEST(test_minute_tick_redraws_changed_digit);
+
+    return test_failures ? 1 : 0;
+}
@@ -0,0 +1,227 @@
+"""
+Resource packer for the watch's external flash.
+
+Builds one image holding fonts and pictures that the firmware reads through flash_resources.c
+instead of linking them into the nRF52840's internal flash. The layout is documented in
+Firmware/Gecko/src/Peripherals/Display/flash_resources.h and the output is programmed at
+FLASH_RESOURCES_ADDRESS.
+
+Resources:
+    --font NAME=FILE.c          An LVGL C font (lv_font_conv --format lvgl, or LVGL's own
+                                lv_font_montserrat_*.c), converted to the streamed "GFNT" format
+    --image NAME=FILE.png       A PNG, stored in the rle format of asset_decoder.c (name it *.rle)
+    --image NAME=FILE.c:ARRAY:WxH
+                                An RGB565 C array, as asset_compiler.py --c-array
+    --file NAME=FILE            Copied as is, e.g. an LVGL .bin image for the built in decoder
+
+Usage:
+    python resource_packer.py -o resources.bin --font montserrat_24=lv_font_montserrat_24.c \\
+        --image sloth.rle=../../Firmware/Gecko/assets/sloth.png
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Asset Compiler"))
+import asset_compiler  # noqa: E402
+
+# Must match flash_resources.h
+RESOURCES_VERSION = 1
+RESOURCES_HEADER_SIZE = 16
+RESOURCES_ENTRY_SIZE = 32
+RESOURCES_NAME_LENGTH = 24
+FONT_VERSION = 1
+FONT_HEADER_SIZE = 32
+FONT_GLYPH_SIZE = 16
+RESOURCE_ALIGN = 4
+
+
+def c_array(source, name, path):
+    match = re.search(r"\b" + re.escape(name) + r"\s*\[\s*\]\s*=\s*\{(.*?)\};", source, re.S)
+    if not match:
+        sys.exit(f"{name} not found in {path}")
+    body = re.sub(r"/\*.*?\*/|//[^\n]*", "", match.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def c_field(source, name, path, default=None):
+    match = re.search(r"\." + name + r"\s*=\s*(-?\w+)", source)
+    if not match:
+        if default is None:
+            sys.exit(f".{name} not found in {path}")
+        return default
+    return int(match.group(1), 0)
+
+
+def load_lvgl_font(path):
+    """ Pull glyphs, code points and kerning out of an lv_font_fmt_txt C font """
+    source = open(path, "r").read()
+
+    if c_field(source, "bitmap_format", path, 0) != 0:
+        sys.exit(f"{path} has compressed bitmaps, regenerate it with lv_font_conv --no-compress")
+
+    bitmaps = bytes(c_array(source, "glyph_bitmap", path))
+    glyph_dsc = [tuple(int(v) for v in m) for m in re.findall(
+        r"\{\s*\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),\s*\.box_h\s*=\s*(\d+),"
+        r"\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\s*\}", source)]
+
+    # Code point -> glyph id, the same walk as lv_font_fmt_txt.c does per lookup
+    code_points = {}
+    for m in re.finditer(
+            r"\.range_start\s*=\s*(\d+),\s*\.range_length\s*=\s*(\d+),\s*\.glyph_id_start\s*=\s*(\d+),"
+            r"\s*\.unicode_list\s*=\s*(\w+),\s*\.glyph_id_ofs_list\s*=\s*(\w+),\s*\.list_length\s*=\s*(\d+),"
+            r"\s*\.type\s*=\s*LV_FONT_FMT_TXT_CMAP_(\w+)", source):
+        start, length, id_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+        unicode_list = None if m.group(4) == "NULL" else c_array(source, m.group(4), path)
+        ofs_list = None if m.group(5) == "NULL" else c_array(source, m.group(5), path)
+        list_length, kind = int(m.group(6)), m.group(7)
+
+        if kind == "FORMAT0_TINY":
+            pairs = [(start + i, id_start + i) for i in range(length)]
+        elif kind == "FORMAT0_FULL":
+            pairs = [(start + i, id_start + ofs_list[i]) for i in range(length)]
+        elif kind == "SPARSE_TINY":
+            pairs = [(start + u, id_start + i) for i, u in enumerate(unicode_list[:list_length])]
+        elif kind == "SPARSE_FULL":
+            pairs = [(start + u, id_start + ofs_list[i]) for i, u in enumerate(unicode_list[:list_length])]
+        else:
+            sys.exit(f"Unknown cmap type {kind} in {path}")
+        code_points.update(pairs)
+
+    if not glyph_dsc or not code_points:
+        sys.exit(f"No glyphs found in {path}, is it an LVGL C font?")
+
+    # Only class based kerning is streamed, pair kerning would need a search per character
+    left_classes = right_classes = 0
+    left_map = right_map = kern = None
+    if re.search(r"\.kern_classes\s*=\s*1", source):
+        left_map = c_array(source, "kern_left_class_mapping", path)
+        right_map = c_array(source, "kern_right_class_mapping", path)
+        kern = c_array(source, "kern_class_values", path)
+        left_classes = c_field(source, "left_class_cnt", path)
+        right_classes = c_field(source, "right_class_cnt", path)
+    elif re.search(r"\.kern_dsc\s*=\s*&", source):
+        print(f"Warning: {path} uses pair kerning, it is dropped", file=sys.stderr)
+
+    return {
+        "bitmaps": bitmaps,
+        "glyph_dsc": glyph_dsc,
+        "code_points": code_points,
+        "bpp": c_field(source, "bpp", path),
+        "kern_scale": c_field(source, "kern_scale", path, 16),
+        "line_height": c_field(source, "line_height", path),
+        "base_line": c_field(source, "base_line", path),
+        "underline_position": c_field(source, "underline_position", path, 0),
+        "underline_thickness": c_field(source, "underline_thickness", path, 0),
+        "left_classes": left_classes,
+        "right_classes": right_classes,
+        "left_map": left_map,
+        "right_map": right_map,
+        "kern": kern,
+    }
+
+
+def encode_font(font):
+    glyphs = b""
+    bitmaps = b""
+    bpp = font["bpp"]
+
+    for unicode in sorted(font["code_points"]):
+        glyph_id = font["code_points"][unicode]
+        bitmap_index, adv_w, box_w, box_h, ofs_x, ofs_y = font["glyph_dsc"][glyph_id]
+        size = (box_w * box_h * bpp + 7) // 8
+        left = font["left_map"][glyph_id] if font["left_map"] else 0
+        right = font["right_map"][glyph_id] if font["right_map"] else 0
+
+        glyphs += struct.pack("<IIHBBbbBB", unicode, len(bitmaps), adv_w, box_w, box_h, ofs_x, ofs_y, left, right)
+        bitmaps += font["bitmaps"][bitmap_index:bitmap_index + size]
+
+    kern = bytes(v & 0xFF for v in font["kern"]) if font["kern"] else b""
+    glyphs_offset = FONT_HEADER_SIZE
+    kern_offset = glyphs_offset + len(glyphs)
+    bitmaps_offset = kern_offset + len(kern)
+
+    header = b"GFNT" + struct.pack("<BBHhhbBBBHHIII", FONT_VERSION, bpp, len(font["code_points"]),
+                                   font["line_height"], font["base_line"],
+                                   font["underline_position"], font["underline_thickness"],
+                                   font["left_classes"], font["right_classes"], font["kern_scale"], 0,
+                                   glyphs_offset, kern_offset, bitmaps_offset)
+    assert len(header) == FONT_HEADER_SIZE
+    return header + glyphs + kern + bitmaps
+
+
+def encode_image(spec):
+    if spec.lower().endswith(".png"):
+        width, height, pixels = asset_compiler.load_png(spec)
+    else:
+        path, name, size = spec.rsplit(":", 2)
+        width, height, pixels = asset_compiler.load_c_array(f"{path}:{name}", size)
+
+    _, (cf, data) = asset_compiler.compile_asset(width, height, pixels, "rle", True)
+    # lv_img_header_t: cf:5, always_zero:3, reserved:2, w:11, h:11
+    return struct.pack("<I", cf | (width << 10) | (height << 21)) + data
+
+
+def pack(resources):
+    table = b""
+    blobs = b""
+    data_start = RESOURCES_HEADER_SIZE + RESOURCES_ENTRY_SIZE * len(resources)
+
+    for name, data in resources:
+        offset = data_start + len(blobs)
+        table += name.encode().ljust(RESOURCES_NAME_LENGTH, b"\0") + struct.pack("<II", offset, len(data))
+        blobs += data + b"\0" * (-len(data) % RESOURCE_ALIGN)
+
+    size = data_start + len(blobs)
+    header = b"GRES" + struct.pack("<HHII", RESOURCES_VERSION, len(resources), size, 0)
+    return header + table + blobs
+
+
+def split_spec(spec, parser):
+    if "=" not in spec:
+        parser.error(f"{spec}: expected NAME=SOURCE")
+    name, source = spec.split("=", 1)
+    if not 0 < len(name.encode()) < RESOURCES_NAME_LENGTH:
+        parser.error(f"{name}: names are 1 to {RESOURCES_NAME_LENGTH - 1} bytes")
+    return name, source
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack fonts and images into an external flash image")
+    parser.add_argument("-o", "--output", required=True, help="Binary image to write")
+    parser.add_argument("--font", action="append", default=[], help="NAME=lv_font.c")
+    parser.add_argument("--image", action="append", default=[], help="NAME=image.png or NAME=file.c:ARRAY:WxH")
+    parser.add_argument("--file", action="append", default=[], help="NAME=file, copied unchanged")
+    args = parser.parse_args()
+
+    resources = []
+    for spec in args.font:
+        name, path = split_spec(spec, parser)
+        font = load_lvgl_font(path)
+        resources.append((name, encode_font(font)))
+        print(f"{name}: {len(font['code_points'])} glyphs, {font['bpp']} bpp, {len(resources[-1][1])} bytes")
+    for spec in args.image:
+        name, source = split_spec(spec, parser)
+        resources.append((name, encode_image(source)))
+        print(f"{name}: {len(resources[-1][1])} bytes")
+    for spec in args.file:
+        name, path = split_spec(spec, parser)
+        resources.append((name, open(path, "rb").read()))
+        print(f"{name}: {len(resources[-1][1])} bytes")
+
+    if not resources:
+        parser.error("nothing to pack")
+    if len({name for name, _ in resources}) != len(resources):
+        parser.error("resource names must be unique")
+
+    image = pack(resources)
+    with open(args.output, "wb") as file:
+        file.write(image)
+    print(f"{args.output}: {len(resources)} resources, {len(image)} bytes")
+
+
+if __name__ == "__main__":
+    main()
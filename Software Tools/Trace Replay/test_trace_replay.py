@@ -0,0 +1,73 @@
+"""
+Checks trace_replay.py against fixtures/stock_scene.gtrc, the Display Visualizer's stock scene recorded
+by its emulator ("make check" there keeps the two in step). The emulator stamps every record with the
+wire time at 32 MHz and nothing else, so with no per transfer overhead the replay has to land on the
+emulator's own numbers: 18104 bytes in 43 transfers, 4526 us on the wire.
+
+Usage:
+    python test_trace_replay.py
+"""
+
+import os
+import tempfile
+import unittest
+
+import trace_replay
+
+FIXTURE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "fixtures", "stock_scene.gtrc")
+
+
+class StockScene(unittest.TestCase):
+    def setUp(self):
+        self.data = trace_replay.load_trace(FIXTURE)
+        self.spi_hz, self.dropped, self.records = trace_replay.parse(self.data)
+
+    def recorded(self):
+        return trace_replay.Model(self.spi_hz, 0.0, 1.0, False).run(self.records)
+
+    def test_header(self):
+        self.assertEqual(self.spi_hz, 32000000)
+        self.assertEqual(self.dropped, 0)
+        self.assertEqual(len(self.records), 43)
+        self.assertEqual(trace_replay.recorded_pixel_bits(self.records), 16)
+
+    def test_traffic_matches_emulator(self):
+        commands, dc_toggles, transfers = trace_replay.traffic(self.records)
+        self.assertEqual(transfers, 43)
+        self.assertEqual(dc_toggles, 35)
+        self.assertEqual(commands, {"RAMWR": 12, "CASET": 6, "RASET": 6})
+
+    def test_recorded_timing_matches_emulator(self):
+        result = self.recorded()
+        self.assertEqual(result["bytes"], 18104)
+        self.assertAlmostEqual(result["busy"], 4526.0)
+        self.assertAlmostEqual(result["duration"], 4526.0)
+        # Back to back on the wire, there is no CPU time left between the records
+        self.assertEqual(max(result["gaps"]), 0.0)
+
+    def test_model_clock(self):
+        recorded = self.recorded()
+        model = trace_replay.Model(16000000, 0.0, 1.0, False).run(self.records, recorded["gaps"])
+        self.assertEqual(model["bytes"], 18104)
+        self.assertAlmostEqual(model["busy"], 2 * 4526.0)
+
+    def test_model_pixel_bits(self):
+        # 72 bytes of commands and window parameters stay, the 9016 pixels go from 2 bytes to 1.5
+        recorded = self.recorded()
+        model = trace_replay.Model(self.spi_hz, 0.0, 12 / 16, False).run(self.records, recorded["gaps"])
+        self.assertEqual(model["bytes"], 72 + 9016 * 3 // 2)
+
+    def test_console_dump(self):
+        # The same trace pulled out of a "gc9a01_trace dump" in a console log
+        lines = [self.data[i:i + 32].hex() for i in range(0, len(self.data), 32)]
+        log = "uart:~$ gc9a01_trace dump\ngc9a01 trace, %d bytes, 0 dropped:\n%s\ngc9a01 trace end\n" % (
+            len(self.data), "\n".join(lines))
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, "session.log")
+            with open(path, "w") as file:
+                file.write(log)
+            self.assertEqual(trace_replay.load_trace(path), self.data)
+
+
+if __name__ == "__main__":
+    unittest.main()
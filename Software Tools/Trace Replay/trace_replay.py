@@ -0,0 +1,285 @@
+"""
+Replay a display bus trace through a timing model.
+
+The firmware records every command and data transfer it sends to the GC9A01 when built with
+CONFIG_GC9A01_TRACE, the format is documented in Firmware/Gecko/drivers/display/gc9a01_trace.h.
+This tool rebuilds the session twice, once with the settings the trace was taken with and once with
+the ones given here (SPI clock, per transfer overhead, pixel depth, async DMA), and prints flush
+times, bus time and an energy estimate for both. Compare a real session, e.g. waking up and
+reading notifications, against a proposed driver change without reflashing.
+
+The CPU time between transfers is taken from the trace with the modelled wire time of the recorded
+setup taken out, so it is only as good as the model: calibrate --overhead-us against a trace of a
+known flush first. The currents are rough numbers for the Gecko board, pass measured ones.
+
+Input is either the binary trace (gc9a01_trace_get()) or a console log with "gc9a01_trace dump" in
+it, -o saves the binary pulled out of a log.
+
+Usage:
+    python trace_replay.py session.log --clock 16000000
+    python trace_replay.py session.log --pixel-bits 12 --flushes
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+# Must match gc9a01_trace.h
+TRACE_VERSION = 1
+TRACE_HEADER_SIZE = 20
+TRACE_CMD = 0x01
+TRACE_DATA = 0x02
+TRACE_FLUSH_BEGIN = 0x03
+TRACE_FLUSH_END = 0x04
+TRACE_BRIGHTNESS = 0x05
+TRACE_ASYNC = 0x80
+
+RAMWR = 0x2C
+MEM_WR_CONT = 0x3C
+COLMOD = 0x3A
+COMMAND_NAMES = {0x2A: "CASET", 0x2B: "RASET", RAMWR: "RAMWR", MEM_WR_CONT: "MEM_WR_CONT", COLMOD: "COLMOD",
+                 0x33: "VSCRDEF", 0x37: "VSCRSADD", 0x10: "SLPIN", 0x11: "SLPOUT", 0x12: "PTLON", 0x13: "NORON",
+                 0x28: "DISPOFF", 0x29: "DISPON", 0x38: "IDMOFF", 0x39: "IDMON"}
+COLMOD_BITS = {0x03: 12, 0x05: 16, 0x06: 18}
+
+# The driver sets the backlight to half at boot
+START_BRIGHTNESS = 128
+
+
+def load_trace(path):
+    with open(path, "rb") as file:
+        data = file.read()
+    if data.startswith(b"GTRC"):
+        return data
+
+    # Console log, the hex lines between the dump's start and end lines
+    text = data.decode("utf-8", "replace")
+    match = re.search(r"gc9a01 trace, \d+ bytes.*?\n(.*?)gc9a01 trace end", text, re.S)
+    if not match:
+        sys.exit(f"{path}: not a trace and no trace dump found in it")
+    hex_text = "".join(line.strip() for line in match.group(1).splitlines()
+                       if re.fullmatch(r"[0-9a-fA-F]+", line.strip()))
+    return bytes.fromhex(hex_text)
+
+
+def varint(data, pos):
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def parse(data):
+    """ Header fields and the list of records as (time_us, type, async, fields) """
+    if len(data) < TRACE_HEADER_SIZE or data[:4] != b"GTRC":
+        sys.exit("Not a GC9A01 trace")
+    version = data[4]
+    spi_hz, length, dropped = struct.unpack_from("<III", data, 8)
+    if version != TRACE_VERSION:
+        sys.exit(f"Trace version {version}, this tool reads {TRACE_VERSION}")
+    end = TRACE_HEADER_SIZE + length
+    if end > len(data):
+        sys.exit(f"Trace is cut short, {len(data) - TRACE_HEADER_SIZE} of {length} bytes")
+
+    records = []
+    pos = TRACE_HEADER_SIZE
+    now = 0
+    last_cmd = None
+    while pos < end:
+        kind = data[pos] & ~TRACE_ASYNC
+        is_async = bool(data[pos] & TRACE_ASYNC)
+        dt, pos = varint(data, pos + 1)
+        now += dt
+
+        if kind == TRACE_CMD:
+            last_cmd = data[pos]
+            fields = {"cmd": last_cmd}
+            pos += 1
+        elif kind == TRACE_DATA:
+            size, pos = varint(data, pos)
+            pixels = last_cmd in (RAMWR, MEM_WR_CONT)
+            fields = {"len": size, "pixels": pixels, "cmd": last_cmd, "bytes": b""}
+            if not pixels and size <= 8:
+                fields["bytes"] = data[pos:pos + size]
+                pos += size
+        elif kind == TRACE_FLUSH_BEGIN:
+            area = []
+            for _ in range(4):
+                value, pos = varint(data, pos)
+                area.append(value)
+            fields = {"area": tuple(area)}
+        elif kind == TRACE_FLUSH_END:
+            fields = {}
+        elif kind == TRACE_BRIGHTNESS:
+            fields = {"level": data[pos]}
+            pos += 1
+        else:
+            sys.exit(f"Unknown record type {kind:#x} at byte {pos}")
+
+        records.append((now, kind, is_async, fields))
+
+    return spi_hz, dropped, records
+
+
+class Model:
+    def __init__(self, clock, overhead_us, pixel_scale, async_pixels):
+        self.clock = clock
+        self.overhead_us = overhead_us
+        self.pixel_scale = pixel_scale
+        self.async_pixels = async_pixels
+
+    def transfer_us(self, length, pixels):
+        if pixels:
+            length = int(length * self.pixel_scale + 0.5)
+        return self.overhead_us + length * 8 * 1e6 / self.clock, length
+
+    def run(self, records, cpu_gaps=None):
+        """
+        Walk the records on this model's bus. Without cpu_gaps the recorded times are taken as is and
+        the CPU time between records is worked out, with them the records are placed by those gaps.
+        """
+        gaps = []
+        ret = 0.0       # CPU is free to go on
+        bus_free = 0.0  # Last byte of the last transfer is out
+        busy_us = 0.0
+        wire_bytes = 0
+        flush_start = None
+        flushes = []
+        brightness = START_BRIGHTNESS
+        brightness_at = 0.0
+        backlight = 0.0  # Brightness (0-1) times microseconds
+
+        for i, (stamp, kind, is_async, fields) in enumerate(records):
+            if cpu_gaps is None:
+                gaps.append(max(0.0, stamp - ret))
+                now = stamp
+            else:
+                now = ret + cpu_gaps[i]
+
+            if kind in (TRACE_CMD, TRACE_DATA):
+                pixels = kind == TRACE_DATA and fields["pixels"]
+                cost, length = self.transfer_us(1 if kind == TRACE_CMD else fields["len"], pixels)
+                start = max(now, bus_free)
+                bus_free = start + cost
+                busy_us += cost
+                wire_bytes += length
+                overlap = is_async if cpu_gaps is None else (pixels and self.async_pixels)
+                ret = start if overlap else bus_free
+            else:
+                ret = now
+                if kind == TRACE_FLUSH_BEGIN:
+                    flush_start = now
+                elif kind == TRACE_FLUSH_END and flush_start is not None:
+                    flushes.append(max(ret, bus_free) - flush_start)
+                    flush_start = None
+                elif kind == TRACE_BRIGHTNESS:
+                    backlight += brightness / 255 * (now - brightness_at)
+                    brightness, brightness_at = fields["level"], now
+
+        end = max(ret, bus_free)
+        backlight += brightness / 255 * (end - brightness_at)
+        return {"gaps": gaps, "duration": end, "busy": busy_us, "bytes": wire_bytes,
+                "flushes": flushes, "backlight": backlight}
+
+
+def traffic(records):
+    commands = {}
+    dc_toggles = 0
+    last_dc = None
+    transfers = 0
+    for _, kind, _, fields in records:
+        if kind not in (TRACE_CMD, TRACE_DATA):
+            continue
+        transfers += 1
+        dc = kind == TRACE_DATA
+        if last_dc is not None and dc != last_dc:
+            dc_toggles += 1
+        last_dc = dc
+        if kind == TRACE_CMD:
+            name = COMMAND_NAMES.get(fields["cmd"], "other")
+            commands[name] = commands.get(name, 0) + 1
+    return commands, dc_toggles, transfers
+
+
+def recorded_pixel_bits(records):
+    bits = 16
+    for _, kind, _, fields in records:
+        if kind == TRACE_DATA and fields["cmd"] == COLMOD and fields["bytes"]:
+            bits = COLMOD_BITS.get(fields["bytes"][0] & 0x07, bits)
+    return bits
+
+
+def summary(name, result, args):
+    flushes = result["flushes"]
+    energy_bus = args.volts * args.bus_ma * result["busy"] / 1000
+    print(f"{name}:")
+    print(f"  session      {result['duration'] / 1000:10.1f} ms, bus busy {result['busy'] / 1000:.1f} ms, "
+          f"{result['bytes']} bytes")
+    if flushes:
+        print(f"  flushes      {len(flushes)}, avg {sum(flushes) / len(flushes) / 1000:.2f} ms, "
+              f"max {max(flushes) / 1000:.2f} ms, total {sum(flushes) / 1000:.1f} ms")
+    print(f"  bus energy   {energy_bus:.1f} uJ")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay a GC9A01 bus trace through a timing model")
+    parser.add_argument("trace", help="Binary trace or a console log with a trace dump in it")
+    parser.add_argument("-o", "--output", help="Save the binary trace (handy with a console log)")
+    parser.add_argument("--clock", type=int, help="SPI clock in Hz to model, default is the recorded one")
+    parser.add_argument("--overhead-us", type=float, default=6.0,
+                        help="Fixed cost of every transfer: DC pin, driver call and DMA setup (default 6)")
+    parser.add_argument("--pixel-bits", type=int, choices=(12, 16, 18),
+                        help="Pixel depth to model, default is the recorded one")
+    mode = parser.add_mutually_exclusive_group()
+    mode.add_argument("--async", dest="async_pixels", action="store_true", default=None,
+                      help="Pixel transfers run while the CPU carries on")
+    mode.add_argument("--sync", dest="async_pixels", action="store_false", help="Pixel transfers block")
+    parser.add_argument("--volts", type=float, default=3.7, help="Supply voltage for energy (default 3.7)")
+    parser.add_argument("--bus-ma", type=float, default=3.0,
+                        help="Extra current while the display bus is busy, mA (default 3)")
+    parser.add_argument("--backlight-ma", type=float, default=15.0,
+                        help="Backlight current at full brightness, mA (default 15)")
+    parser.add_argument("--flushes", action="store_true", help="List every flush")
+    args = parser.parse_args()
+
+    data = load_trace(args.trace)
+    if args.output:
+        with open(args.output, "wb") as file:
+            file.write(data)
+    spi_hz, dropped, records = parse(data)
+    if not records:
+        sys.exit("Trace has no records")
+
+    recorded_async = any(is_async for _, _, is_async, _ in records)
+    bits = recorded_pixel_bits(records)
+    model_bits = args.pixel_bits or bits
+    model_async = recorded_async if args.async_pixels is None else args.async_pixels
+
+    recorded = Model(spi_hz, args.overhead_us, 1.0, recorded_async).run(records)
+    model = Model(args.clock or spi_hz, args.overhead_us, model_bits / bits, model_async).run(records, recorded["gaps"])
+
+    commands, dc_toggles, transfers = traffic(records)
+    print(f"{args.trace}: {len(records)} records, {dropped} dropped" + (" (trace is incomplete)" if dropped else ""))
+    print(f"  {transfers} transfers, {dc_toggles} DC toggles, commands: " +
+          ", ".join(f"{name} {count}" for name, count in sorted(commands.items(), key=lambda c: -c[1])))
+    # The backlight doesn't care how the pixels got there, it comes from the recorded timeline only
+    print(f"  backlight {args.volts * args.backlight_ma * recorded['backlight'] / 1e6:.2f} mJ")
+    summary(f"Recorded ({spi_hz / 1e6:g} MHz, {bits} bit, {'async' if recorded_async else 'sync'})", recorded, args)
+    summary(f"Model ({(args.clock or spi_hz) / 1e6:g} MHz, {model_bits} bit, {'async' if model_async else 'sync'})",
+            model, args)
+
+    if args.flushes:
+        areas = [fields["area"] for _, kind, _, fields in records if kind == TRACE_FLUSH_BEGIN]
+        print("  flush  x    y    w    h      recorded ms  model ms")
+        for i, (before, after) in enumerate(zip(recorded["flushes"], model["flushes"])):
+            x, y, w, h = areas[i]
+            print(f"  {i:5d}  {x:3d}  {y:3d}  {w:3d}  {h:3d}  {before / 1000:10.3f}  {after / 1000:8.3f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "png.h"
+
+/*
+    Minimal PNG writer, the image data goes in as "stored" (uncompressed) deflate blocks so no
+    zlib is needed. Files are bigger than they could be but any viewer opens them.
+*/
+
+#define DEFLATE_STORED_MAX 65535
+
+static uint32_t crc_table[256];
+
+static void crc_table_init(void)
+{
+    for (uint32_t n = 0; n < 256; n++)
+    {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t* data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+static void put_be32(uint8_t* dst, uint32_t value)
+{
+    dst[0] = value >> 24;
+    dst[1] = value >> 16;
+    dst[2] = value >> 8;
+    dst[3] = value;
+}
+
+static int write_chunk(FILE* file, const char* type, const uint8_t* data, uint32_t len)
+{
+    uint8_t header[8];
+    uint8_t footer[4];
+    uint32_t crc = 0xFFFFFFFFu;
+
+    put_be32(header, len);
+    memcpy(&header[4], type, 4);
+    crc = crc_update(crc, &header[4], 4);
+    crc = crc_update(crc, data, len);
+    put_be32(footer, crc ^ 0xFFFFFFFFu);
+
+    if (fwrite(header, 1, 8, file) != 8) return -1;
+    if (len && fwrite(data, 1, len, file) != len) return -1;
+    if (fwrite(footer, 1, 4, file) != 4) return -1;
+    return 0;
+}
+
+int png_write_rgb(const char* path, const uint8_t* rgb, uint32_t width, uint32_t height)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t ihdr[13];
+    size_t row_len = 1 + width * 3; // Filter byte + pixels
+    size_t raw_len = row_len * height;
+    size_t block_count = (raw_len + DEFLATE_STORED_MAX - 1) / DEFLATE_STORED_MAX;
+    size_t idat_len = 2 + raw_len + block_count * 5 + 4; // zlib header, blocks, adler32
+    uint8_t* raw;
+    uint8_t* idat;
+    uint8_t* out;
+    uint32_t adler_a = 1, adler_b = 0;
+    FILE* file;
+    int err;
+
+    if (crc_table[1] == 0) crc_table_init();
+
+    raw = malloc(raw_len);
+    idat = malloc(idat_len);
+    if (!raw || !idat)
+    {
+        free(raw);
+        free(idat);
+        return -1;
+    }
+
+    // Every row uses filter type 0 (none)
+    for (uint32_t y = 0; y < height; y++)
+    {
+        raw[y * row_len] = 0;
+        memcpy(&raw[y * row_len + 1], &rgb[y * width * 3], width * 3);
+    }
+
+    out = idat;
+    *out++ = 0x78; // Deflate, 32k window
+    *out++ = 0x01; // No preset dictionary, fastest, header checksum
+    for (size_t pos = 0; pos < raw_len; pos += DEFLATE_STORED_MAX)
+    {
+        uint16_t len = (raw_len - pos > DEFLATE_STORED_MAX) ? DEFLATE_STORED_MAX : raw_len - pos;
+
+        *out++ = (pos + len == raw_len) ? 1 : 0; // Final block flag, block type 00 (stored)
+        *out++ = len & 0xFF;
+        *out++ = len >> 8;
+        *out++ = ~len & 0xFF;
+        *out++ = (~len >> 8) & 0xFF;
+        memcpy(out, &raw[pos], len);
+        out += len;
+    }
+    for (size_t i = 0; i < raw_len; i++)
+    {
+        adler_a = (adler_a + raw[i]) % 65521;
+        adler_b = (adler_b + adler_a) % 65521;
+    }
+    put_be32(out, (adler_b << 16) | adler_a);
+
+    put_be32(&ihdr[0], width);
+    put_be32(&ihdr[4], height);
+    ihdr[8] = 8;  // Bit depth
+    ihdr[9] = 2;  // Truecolor
+    ihdr[10] = 0; // Deflate
+    ihdr[11] = 0; // Adaptive filtering
+    ihdr[12] = 0; // No interlace
+
+    err = -1;
+    file = fopen(path, "wb");
+    if (file)
+    {
+        if (fwrite(signature, 1, sizeof(signature), file) == sizeof(signature) &&
+            write_chunk(file, "IHDR", ihdr, sizeof(ihdr)) == 0 &&
+            write_chunk(file, "IDAT", idat, idat_len) == 0 &&
+            write_chunk(file, "IEND", NULL, 0) == 0)
+        {
+            err = 0;
+        }
+        fclose(file);
+    }
+
+    free(raw);
+    free(idat);
+    return err;
+}
@@ -0,0 +1,9 @@
+#ifndef __PNG_H__
+#define __PNG_H__
+
+#include <stdint.h>
+
+// Write 8 bit RGB rows (3 bytes per pixel) as an uncompressed PNG, returns 0 on success
+int png_write_rgb(const char* path, const uint8_t* rgb, uint32_t width, uint32_t height);
+
+#endif // __PNG_H__